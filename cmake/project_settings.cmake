@@ -320,6 +320,27 @@ macro(_flux_unit_tests _ARG_NAME _TESTS_SOURCE)
     endif()
 endmacro(_flux_unit_tests)
 
+option(FLUX_BUILD_BENCHMARKS "Build the benchmarks of the libraries." NO)
+
+# This macro is used by `flux_static_library` and `flux_interface_library` functions. Don't call
+# it unless you know what you are doing. The benchmarks are not registered as tests, so that they
+# don't slow down the unit tests, run `flux_<name>_benchmarks` from an optimized build instead.
+macro(_flux_benchmarks _ARG_NAME _BENCHMARKS_SOURCE)
+    if(NOT "${_BENCHMARKS_SOURCE}" STREQUAL "" AND FLUX_BUILD_BENCHMARKS)
+        find_package(Catch2 REQUIRED)
+        set(_BENCHMARKS flux_${_ARG_NAME}_benchmarks)
+        add_executable(${_BENCHMARKS})
+        target_sources(${_BENCHMARKS} PRIVATE "${_BENCHMARKS_SOURCE}")
+        target_compile_definitions(${_BENCHMARKS} PRIVATE -DCATCH_CONFIG_CONSOLE_WIDTH=300
+                                                          -DCATCH_CONFIG_ENABLE_BENCHMARKING)
+        target_link_libraries(${_BENCHMARKS}
+                              PRIVATE Catch2::Catch2
+                                      flux::${_ARG_NAME})
+        install(TARGETS ${_BENCHMARKS}
+                RUNTIME DESTINATION flux-${_ARG_NAME}/bin)
+    endif()
+endmacro(_flux_benchmarks)
+
 # This macro is used by `flux_static_library` and `flux_interface_library` functions. Don't call
 # it unless you know what you are doing.
 macro(_flux_install_headers _ARG_NAME _ARG_DIRS)
@@ -361,17 +382,17 @@ endfunction(flux_metal_library)
 
 # flux_static_library(<name>
 #     <WINDOWS|MACOSX|LINUX|COMMON>
-#          <SOURCE|TEST|LINK|INCLUDE_DIR> items...
-#         [<SOURCE|TEST|LINK|INCLUDE_DIR> items...]...
+#          <SOURCE|TEST|BENCHMARK|LINK|INCLUDE_DIR> items...
+#         [<SOURCE|TEST|BENCHMARK|LINK|INCLUDE_DIR> items...]...
 #     [<WINDOWS|MACOSX|LINUX|COMMON>
-#          <SOURCE|TEST|LINK|INCLUDE_DIR> items...
-#         [<SOURCE|TEST|LINK|INCLUDE_DIR> items...]...]...)
+#          <SOURCE|TEST|BENCHMARK|LINK|INCLUDE_DIR> items...
+#         [<SOURCE|TEST|BENCHMARK|LINK|INCLUDE_DIR> items...]...]...)
 function(_flux_static_library _ARG_NAME)
-    cmake_parse_arguments(PARSE_ARGV 1                      # start at the 1st argument
-                          _ARG                              # variable prefix
-                          ""                                # options
-                          ""                                # one   value keywords
-                          "SOURCE;TEST;LINK;INCLUDE_DIR")   # multi value keywords
+    cmake_parse_arguments(PARSE_ARGV 1                                # start at the 1st argument
+                          _ARG                                        # variable prefix
+                          ""                                          # options
+                          ""                                          # one   value keywords
+                          "SOURCE;TEST;BENCHMARK;LINK;INCLUDE_DIR")   # multi value keywords
     set(_TARGET "flux_${_ARG_NAME}")
     add_library(${_TARGET} STATIC)
     add_library("flux::${_ARG_NAME}" ALIAS ${_TARGET})
@@ -384,6 +405,7 @@ function(_flux_static_library _ARG_NAME)
             ARCHIVE DESTINATION flux-${_ARG_NAME}/lib)
     _flux_install_headers("${_ARG_NAME}" ".;${_ARG_INCLUDE_DIR}")
     _flux_unit_tests("${_ARG_NAME}" "${_ARG_TEST}")
+    _flux_benchmarks("${_ARG_NAME}" "${_ARG_BENCHMARK}")
 endfunction(_flux_static_library)
 
 function(flux_static_library _ARG_NAME)
@@ -415,17 +437,17 @@ endfunction(flux_static_library)
 
 # flux_interface_library(<name>
 #     <WINDOWS|MACOSX|LINUX|COMMON>
-#          <TEST|LINK> items...
-#         [<TEST|LINK> items...]...
+#          <TEST|BENCHMARK|LINK> items...
+#         [<TEST|BENCHMARK|LINK> items...]...
 #     [<WINDOWS|MACOSX|LINUX|COMMON>
-#          <TEST|LINK> items...
-#         [<TEST|LINK> items...]...]...)
+#          <TEST|BENCHMARK|LINK> items...
+#         [<TEST|BENCHMARK|LINK> items...]...]...)
 function(_flux_interface_library _ARG_NAME)
-    cmake_parse_arguments(PARSE_ARGV 1   # start at the 1st argument
-                          _ARG           # variable prefix
-                          ""             # options
-                          ""             # one   value keywords
-                          "TEST;LINK")   # multi value keywords
+    cmake_parse_arguments(PARSE_ARGV 1             # start at the 1st argument
+                          _ARG                     # variable prefix
+                          ""                       # options
+                          ""                       # one   value keywords
+                          "TEST;BENCHMARK;LINK")   # multi value keywords
     set(_TARGET "flux_${_ARG_NAME}")
     add_library(${_TARGET} INTERFACE)
     add_library("flux::${_ARG_NAME}" ALIAS ${_TARGET})
@@ -435,6 +457,7 @@ function(_flux_interface_library _ARG_NAME)
                                     "${_ARG_LINK}")
     _flux_install_headers("${_ARG_NAME}" ".")
     _flux_unit_tests("${_ARG_NAME}" "${_ARG_TEST}")
+    _flux_benchmarks("${_ARG_NAME}" "${_ARG_BENCHMARK}")
 endfunction(_flux_interface_library)
 
 function(flux_interface_library _ARG_NAME)
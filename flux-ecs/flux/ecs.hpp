@@ -0,0 +1,12 @@
+#pragma once
+#include <flux/foundation.hpp>
+
+#include <entt/entity/registry.hpp>
+#include <entt/entity/runtime_view.hpp>
+#include <vector>
+
+// clang-format off
+#include <flux/ecs/storage_allocator.hpp>
+#include <flux/ecs/frame_scratch.hpp>
+#include <flux/ecs/registry.hpp>
+// clang-format on
\ No newline at end of file
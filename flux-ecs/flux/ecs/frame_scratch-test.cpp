@@ -0,0 +1,44 @@
+#include <flux/ecs.hpp>
+
+#include <catch2/catch.hpp>
+
+using namespace flux;
+
+TEST_CASE("ecs::frame_scratch", "[flux-ecs/frame_scratch.hpp]") {
+    ecs::frame_scratch scratch{4096u};
+    auto const         capacity = scratch.stack().capacity();
+
+    for (int frame = 0; frame < 3; ++frame) {
+        auto values = scratch.make_vector<int>();
+        for (int i = 0; i < 10'000; ++i) {
+            values.push_back(i);
+        }
+        CHECK(values.size() == 10'000u);
+        CHECK(values.back() == 9'999);
+
+        // The vector must be gone before the frame ends.
+        values = scratch.make_vector<int>();
+        scratch.reset();
+        CHECK(scratch.stack().capacity() == capacity);
+    }
+
+    SECTION("larger than a block") {
+        auto values = scratch.make_vector<int>();
+        values.reserve(4u * 4096u);
+        for (int i = 0; i < 4 * 4096; ++i) {
+            values.push_back(i);
+        }
+        CHECK(values.back() == 4 * 4096 - 1);
+        CHECK(scratch.stack().capacity() == capacity);
+
+        auto small = scratch.make_vector<int>();
+        small.reserve(scratch.max_stack_size() / sizeof(int));
+        CHECK(scratch.stack().capacity() < capacity);
+    }
+    SECTION("allocators compare equal") {
+        CHECK(scratch.get_allocator<int>() == scratch.get_allocator<float>());
+
+        ecs::frame_scratch other;
+        CHECK(scratch.get_allocator<int>() != other.get_allocator<int>());
+    }
+}
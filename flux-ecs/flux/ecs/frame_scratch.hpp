@@ -0,0 +1,97 @@
+#pragma once
+
+namespace flux::ecs {
+
+// A stateful `RawAllocator` on a `memory_stack` for the short-lived allocations of the systems of a
+// frame: the pools of runtime views, the entities collected during an iteration to be destroyed
+// after it, sorted copies of a view... Nothing allocated from the stack is freed until `reset()`
+// frees everything at once, at the end of the frame. Requests bigger than `max_stack_size()`,
+// which might not fit the next block of the stack, go to the `default_allocator` instead and are
+// freed with their container.
+// NOTE:
+//  It is not thread-safe, every thread running systems needs its own.
+template <typename BlockOrRawAllocator = fou::default_allocator>
+class [[nodiscard]] basic_frame_scratch {
+public:
+    using stack_type      = fou::memory_stack<BlockOrRawAllocator>;
+    using size_type       = typename stack_type::size_type;
+    using difference_type = typename stack_type::difference_type;
+    using stateful        = meta::true_type;
+
+    template <typename T>
+    using allocator = fou::std_allocator_adapter<T, basic_frame_scratch>;
+
+    template <typename T>
+    using vector = ::std::vector<T, allocator<T>>;
+
+    static constexpr size_type default_block_size = size_type{256u} << 10u;
+
+    basic_frame_scratch() noexcept : basic_frame_scratch{default_block_size} {}
+
+    // The stack gets blocks of `block_size` bytes, the `args` are forwarded to its block
+    // allocator.
+    template <typename... Args>
+    explicit basic_frame_scratch(size_type block_size, Args&&... args) noexcept
+            : stack_{block_size, ::std::forward<Args>(args)...}, frame_{stack_.top()},
+              max_stack_size_{stack_.capacity() / stack_size_divisor} {}
+
+    basic_frame_scratch(basic_frame_scratch const&)            = delete;
+    basic_frame_scratch& operator=(basic_frame_scratch const&) = delete;
+
+    void* allocate_node(size_type size, size_type alignment) noexcept {
+        if (size <= max_stack_size_) {
+            return stack_traits::allocate_node(stack_, size, alignment);
+        }
+        return heap_traits::allocate_node(heap_, size, alignment);
+    }
+
+    void deallocate_node(void* node, size_type size, size_type alignment) noexcept {
+        if (size <= max_stack_size_) {
+            stack_traits::deallocate_node(stack_, node, size, alignment);
+        } else {
+            heap_traits::deallocate_node(heap_, node, size, alignment);
+        }
+    }
+
+    template <typename T>
+    allocator<T> get_allocator() noexcept {
+        return allocator<T>{*this};
+    }
+
+    template <typename T>
+    vector<T> make_vector() noexcept {
+        return vector<T>{get_allocator<T>()};
+    }
+
+    // Frees everything allocated since the construction or the previous reset, nothing allocated
+    // from this scratch may be used afterwards.
+    void reset() noexcept {
+        stack_.unwind(frame_);
+    }
+
+    // Returns the size in bytes of the biggest request served by the stack.
+    size_type max_stack_size() const noexcept {
+        return max_stack_size_;
+    }
+
+    stack_type& stack() noexcept {
+        return stack_;
+    }
+
+private:
+    using stack_traits = fou::allocator_traits<stack_type>;
+    using heap_traits  = fou::allocator_traits<fou::default_allocator>;
+
+    // The blocks of the stack only grow, so half of the first one always fits the next one, with
+    // room to spare for the alignment.
+    static constexpr size_type stack_size_divisor = 2u;
+
+    stack_type                                    stack_;
+    typename stack_type::marker                   frame_;
+    FLUX_NO_UNIQUE_ADDRESS fou::default_allocator heap_;
+    size_type                                     max_stack_size_;
+};
+
+using frame_scratch = basic_frame_scratch<>;
+
+} // namespace flux::ecs
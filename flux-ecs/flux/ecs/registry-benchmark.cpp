@@ -0,0 +1,84 @@
+#include <flux/ecs.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+using namespace flux;
+
+namespace {
+
+constexpr int count = 10000;
+
+struct position {
+    int x;
+    int y;
+};
+
+struct velocity {
+    int dx;
+    int dy;
+};
+
+// Creates `count` entities with a position, every other one with a velocity too.
+template <typename Registry>
+::std::vector<entt::entity> populate(Registry& registry) {
+    ::std::vector<entt::entity> entities;
+    entities.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        auto const entity = registry.create();
+        registry.template emplace<position>(entity, i, i);
+        if (i % 2 == 0) {
+            registry.template emplace<velocity>(entity, 1, 2);
+        }
+        entities.push_back(entity);
+    }
+    return entities;
+}
+
+// The registries are constructed from the `args` before the clock starts, so that only the work
+// on the entities is measured.
+template <typename Registry, typename... Args>
+void benchmark_registry(char const* name, Args&... args) {
+    BENCHMARK_ADVANCED(::std::string{name} + " create")(Catch::Benchmark::Chronometer meter) {
+        ::std::deque<Registry> registries;
+        for (int i = 0; i < meter.runs(); ++i)
+            registries.emplace_back(args...);
+        meter.measure([&](int run) {
+            return populate(registries[static_cast<::std::size_t>(run)]);
+        });
+    };
+
+    BENCHMARK_ADVANCED(::std::string{name} + " destroy")(Catch::Benchmark::Chronometer meter) {
+        ::std::deque<Registry>                     registries;
+        ::std::vector<::std::vector<entt::entity>> entities;
+        for (int i = 0; i < meter.runs(); ++i)
+            entities.push_back(populate(registries.emplace_back(args...)));
+        meter.measure([&](int run) {
+            auto const index = static_cast<::std::size_t>(run);
+            registries[index].destroy(entities[index].begin(), entities[index].end());
+        });
+    };
+
+    Registry registry{args...};
+    populate(registry);
+    BENCHMARK(::std::string{name} + " iterate") {
+        long long sum = 0;
+        registry.template view<position, velocity>().each([&sum](position& p, velocity const& v) {
+            p.x += v.dx;
+            p.y += v.dy;
+            sum += p.x;
+        });
+        return sum;
+    };
+}
+
+} // namespace
+
+TEST_CASE("ecs::registry entities", "[flux-ecs/registry.hpp]") {
+    ecs::storage_allocator<> storage;
+    benchmark_registry<ecs::registry>("ecs::registry", storage);
+    benchmark_registry<entt::registry>("entt::registry");
+}
@@ -0,0 +1,107 @@
+#include <flux/ecs.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <random>
+
+using namespace flux;
+
+namespace {
+
+struct position {
+    int x;
+    int y;
+};
+
+struct velocity {
+    int dx;
+    int dy;
+};
+
+// Creates, moves and destroys entities the same way on any registry, returns the sum of the
+// positions of the remaining entities.
+template <typename Registry>
+long long churn(Registry& registry, int rounds) {
+    ::std::mt19937              engine{42u};
+    ::std::vector<entt::entity> alive;
+    for (int round = 0; round < rounds; ++round) {
+        for (int i = 0; i < 1000; ++i) {
+            auto const entity = registry.create();
+            registry.template emplace<position>(entity, i, round);
+            if (i % 2 == 0) {
+                registry.template emplace<velocity>(entity, 1, 2);
+            }
+            alive.push_back(entity);
+        }
+
+        registry.template view<position, velocity>().each([](position& p, velocity const& v) {
+            p.x += v.dx;
+            p.y += v.dy;
+        });
+
+        ::std::shuffle(alive.begin(), alive.end(), engine);
+        auto const half = static_cast<::std::ptrdiff_t>(alive.size() / 2u);
+        registry.destroy(alive.begin() + half, alive.end());
+        alive.resize(alive.size() / 2u);
+    }
+
+    long long sum = 0;
+    registry.template view<position>().each([&](position const& p) { sum += p.x + p.y; });
+    return sum;
+}
+
+} // namespace
+
+TEST_CASE("ecs::registry", "[flux-ecs/registry.hpp]") {
+    ecs::storage_allocator<> storage;
+    ecs::registry            registry{storage};
+    entt::registry           reference;
+
+    CHECK(churn(registry, 10) == churn(reference, 10));
+
+    // The pools are warm, more churn of the same size reuses their free lists.
+    auto const next_capacity = storage.pool().next_capacity();
+    CHECK(churn(registry, 10) == churn(reference, 10));
+    CHECK(storage.pool().next_capacity() == next_capacity);
+
+    registry.clear();
+    CHECK(registry.storage<position>().empty());
+}
+
+TEST_CASE("ecs::runtime_view", "[flux-ecs/registry.hpp]") {
+    using view_type = ecs::runtime_view<ecs::registry>;
+
+    ecs::storage_allocator<> storage;
+    ecs::registry            registry{storage};
+    ecs::frame_scratch       scratch;
+
+    for (int i = 0; i < 100; ++i) {
+        auto const entity = registry.create();
+        registry.emplace<position>(entity, i, 0);
+        if (i % 4 == 0) {
+            registry.emplace<velocity>(entity, 1, 1);
+        }
+    }
+
+    for (int frame = 0; frame < 3; ++frame) {
+        {
+            view_type view{scratch.get_allocator<ecs::common_storage_type<ecs::registry>*>()};
+            view.iterate(registry.storage<position>()).iterate(registry.storage<velocity>());
+
+            // Entities can not be destroyed while they are iterated, they are collected first.
+            auto doomed = scratch.make_vector<entt::entity>();
+            for (auto const entity : view) {
+                if (registry.get<position>(entity).x % 8 == 0) {
+                    doomed.push_back(entity);
+                }
+            }
+            registry.destroy(doomed.begin(), doomed.end());
+        }
+        scratch.reset();
+    }
+
+    // Every 8th entity had a velocity and an `x` that is a multiple of 8.
+    CHECK(registry.storage<position>().size() == 87u);
+    CHECK(registry.storage<velocity>().size() == 12u);
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+namespace flux::ecs {
+
+// The allocator of a registry. entt rebinds it for its sparse sets, component storages and
+// bookkeeping, so all of them allocate from the same `storage_allocator`.
+// clang-format off
+template <
+    typename Entity              = ::entt::entity,
+    typename BlockOrRawAllocator = fou::default_allocator
+>
+using registry_allocator =
+        fou::std_allocator_adapter<Entity, storage_allocator<BlockOrRawAllocator>>;
+
+// An entt registry whose storages are backed by a `storage_allocator`, which must outlive it:
+//  ecs::storage_allocator<> storage;
+//  ecs::registry            registry{storage};
+template <
+    typename Entity              = ::entt::entity,
+    typename BlockOrRawAllocator = fou::default_allocator
+>
+using basic_registry =
+        ::entt::basic_registry<Entity, registry_allocator<Entity, BlockOrRawAllocator>>;
+// clang-format on
+
+using registry = basic_registry<>;
+
+// The type that all storages of a `Registry` derive from.
+template <typename Registry>
+using common_storage_type =
+        ::std::remove_pointer_t<decltype(::std::declval<Registry&>().storage(::entt::id_type{}))>;
+
+// A runtime view of a `Registry` whose list of storages is allocated from a frame scratch:
+//  using view_type = ecs::runtime_view<ecs::registry>;
+//  view_type view{scratch.get_allocator<typename view_type::common_type*>()};
+template <typename Registry, typename BlockOrRawAllocator = fou::default_allocator>
+using runtime_view = ::entt::basic_runtime_view<
+        common_storage_type<Registry>,
+        typename basic_frame_scratch<BlockOrRawAllocator>::template allocator<
+                common_storage_type<Registry>*>>;
+
+} // namespace flux::ecs
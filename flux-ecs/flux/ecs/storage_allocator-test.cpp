@@ -0,0 +1,65 @@
+#include <flux/ecs.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <list>
+
+using namespace flux;
+
+TEST_CASE("ecs::storage_allocator", "[flux-ecs/storage_allocator.hpp]") {
+    using storage_allocator = ecs::storage_allocator<>;
+    using allocator_traits  = fou::allocator_traits<storage_allocator>;
+
+    storage_allocator storage{1u << 16u};
+    CHECK(storage.max_pooled_size() == (1u << 16u) / 16u);
+    CHECK(allocator_traits::max_alignment(storage) == fou::detail::max_alignment);
+    CHECK(allocator_traits::max_node_size(storage) > storage_allocator::max_pooled_node_size);
+
+    SECTION("pooled nodes are reused") {
+        auto* node = allocator_traits::allocate_node(storage, 24u, 8u);
+        CHECK(fou::is_aligned(node, 8u));
+        allocator_traits::deallocate_node(storage, node, 24u, 8u);
+        CHECK(allocator_traits::allocate_node(storage, 24u, 8u) == node);
+        allocator_traits::deallocate_node(storage, node, 24u, 8u);
+    }
+
+    SECTION("pooled arrays are reused") {
+        auto const count = storage.max_pooled_size() / 4u;
+        auto*      array = allocator_traits::allocate_array(storage, count, 4u, 4u);
+        ::std::memset(array, 0xff, count * 4u);
+        allocator_traits::deallocate_array(storage, array, count, 4u, 4u);
+        CHECK(allocator_traits::allocate_array(storage, count, 4u, 4u) == array);
+        allocator_traits::deallocate_array(storage, array, count, 4u, 4u);
+    }
+
+    SECTION("big nodes and arrays") {
+        auto* node = allocator_traits::allocate_node(storage, 1024u, 16u);
+        ::std::memset(node, 0xff, 1024u);
+        allocator_traits::deallocate_node(storage, node, 1024u, 16u);
+
+        auto const count = storage.max_pooled_size();
+        auto*      array = allocator_traits::allocate_array(storage, count, 4u, 4u);
+        ::std::memset(array, 0xff, count * 4u);
+        allocator_traits::deallocate_array(storage, array, count, 4u, 4u);
+    }
+
+    SECTION("std containers") {
+        using allocator = ecs::registry_allocator<::std::uint32_t>;
+
+        // The vector grows past the pooled size, the list only allocates pooled nodes.
+        ::std::vector<::std::uint32_t, allocator> vector{allocator{storage}};
+        ::std::list<::std::uint32_t, allocator>   list{allocator{storage}};
+        for (::std::uint32_t i = 0u; i < 100'000u; ++i) {
+            vector.push_back(i);
+            if (i % 16u == 0u) {
+                list.push_back(i);
+            }
+        }
+
+        for (::std::uint32_t i = 0u; i < 100'000u; ++i) {
+            CHECK(vector[i] == i);
+        }
+        CHECK(list.size() == 6250u);
+        CHECK(list.back() == 99'984u);
+    }
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+namespace flux::ecs {
+
+// A stateful `RawAllocator` for the storages of a registry. Entity churn makes entt allocate and
+// free the same sizes over and over: sparse pages, component pages, packed arrays and the shared
+// storages themselves. Nodes of up to `max_pooled_node_size` bytes and arrays of up to
+// `max_pooled_size()` bytes are served by a `memory_pool_list` with a free list per power of two,
+// so they stop reaching the heap once the free lists are warm. Bigger requests, like the packed
+// array of a storage with many entities, go to the `default_allocator`.
+// NOTE:
+//  It is not thread-safe and it must outlive every registry using it.
+template <typename BlockOrRawAllocator = fou::default_allocator>
+class [[nodiscard]] storage_allocator {
+    using pool_type =
+            fou::memory_pool_list<fou::array_pool, fou::log2_buckets, BlockOrRawAllocator>;
+    using pool_traits = fou::allocator_traits<pool_type>;
+    using heap_traits = fou::allocator_traits<fou::default_allocator>;
+
+public:
+    using allocator_type  = typename pool_type::allocator_type;
+    using size_type       = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+    using stateful        = meta::true_type;
+
+    static constexpr size_type max_pooled_node_size = 256u;
+    static constexpr size_type default_block_size   = size_type{1u} << 20u;
+
+    storage_allocator() noexcept : storage_allocator{default_block_size} {}
+
+    // The pools get blocks of `block_size` bytes, the `args` are forwarded to their block
+    // allocator.
+    template <typename... Args>
+    explicit storage_allocator(size_type block_size, Args&&... args) noexcept
+            : pool_{max_pooled_node_size, block_size, ::std::forward<Args>(args)...},
+              max_pooled_size_{block_size / pooled_size_divisor} {}
+
+    storage_allocator(storage_allocator const&)            = delete;
+    storage_allocator& operator=(storage_allocator const&) = delete;
+
+    void* allocate_node(size_type size, size_type alignment) noexcept {
+        FLUX_ASSERT(alignment <= max_alignment(), "entt types must not be over-aligned");
+        if (size <= max_pooled_node_size) {
+            return pool_traits::allocate_node(pool_, size, alignment);
+        }
+        return heap_traits::allocate_node(heap_, size, alignment);
+    }
+
+    void* allocate_array(size_type count, size_type size, size_type alignment) noexcept {
+        FLUX_ASSERT(alignment <= max_alignment(), "entt types must not be over-aligned");
+        if (is_pooled_array(count, size)) {
+            return pool_traits::allocate_array(pool_, count, size, alignment);
+        }
+        return heap_traits::allocate_array(heap_, count, size, alignment);
+    }
+
+    void deallocate_node(void* node, size_type size, size_type alignment) noexcept {
+        if (size <= max_pooled_node_size) {
+            pool_traits::deallocate_node(pool_, node, size, alignment);
+        } else {
+            heap_traits::deallocate_node(heap_, node, size, alignment);
+        }
+    }
+
+    void deallocate_array(void* array, size_type count, size_type size,
+                          size_type alignment) noexcept {
+        if (is_pooled_array(count, size)) {
+            pool_traits::deallocate_array(pool_, array, count, size, alignment);
+        } else {
+            heap_traits::deallocate_array(heap_, array, count, size, alignment);
+        }
+    }
+
+    size_type max_node_size() const noexcept {
+        return heap_traits::max_node_size(heap_);
+    }
+
+    size_type max_array_size() const noexcept {
+        return heap_traits::max_array_size(heap_);
+    }
+
+    size_type max_alignment() const noexcept {
+        return fou::detail::max_alignment;
+    }
+
+    // Returns the size in bytes of the biggest array served by the pools.
+    size_type max_pooled_size() const noexcept {
+        return max_pooled_size_;
+    }
+
+    pool_type& pool() noexcept {
+        return pool_;
+    }
+
+private:
+    // A `memory_pool_list` refills a free list with a fraction of its next block, one per power of
+    // two up to `max_pooled_node_size`. Pooled arrays are kept below that fraction so that a single
+    // refill always fits them.
+    static constexpr size_type pooled_size_divisor = 16u;
+
+    bool is_pooled_array(size_type count, size_type size) const noexcept {
+        return size <= max_pooled_node_size and count * size <= max_pooled_size_;
+    }
+
+    pool_type                                     pool_;
+    FLUX_NO_UNIQUE_ADDRESS fou::default_allocator heap_;
+    size_type                                     max_pooled_size_;
+};
+
+} // namespace flux::ecs
@@ -7,4 +7,7 @@
 #include <flux/foundation/types.hpp>
 #include <flux/foundation/utility.hpp>
 #include <flux/foundation/memory.hpp>
+#include <flux/foundation/containers.hpp>
+#include <flux/foundation/concurrency.hpp>
+#include <flux/foundation/coroutine.hpp>
 // clang-format on
\ No newline at end of file
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <flux/foundation/concurrency/backoff.hpp>
+#include <flux/foundation/concurrency/epoch_domain.hpp>
+#include <flux/foundation/concurrency/job_system.hpp>
+#include <flux/foundation/concurrency/mpmc_queue.hpp>
+#include <flux/foundation/concurrency/mutex.hpp>
+#include <flux/foundation/concurrency/spsc_queue.hpp>
+#include <flux/foundation/concurrency/task_graph.hpp>
+#include <flux/foundation/concurrency/work_stealing_deque.hpp>
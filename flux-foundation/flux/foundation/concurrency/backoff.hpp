@@ -0,0 +1,47 @@
+#pragma once
+#include <flux/config.hpp>
+
+#include <cstdint>
+#include <thread>
+
+namespace flux::fou {
+
+// Tells the CPU that we are in a spin-wait loop. On x86 this avoids the memory order violation
+// when the loop exits and releases the pipeline to the sibling hyper-thread.
+inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+// An exponential backoff for spin-wait loops. Every call to `pause()` spins twice as long as the
+// previous one, until `spin_limit` is reached, after that the time slice is given up.
+struct [[nodiscard]] backoff final {
+    static constexpr ::std::uint32_t spin_limit = 64u;
+
+    void pause() noexcept {
+        if (count_ < spin_limit) {
+            for (auto i = 0u; i < count_; ++i)
+                cpu_relax();
+            count_ <<= 1u;
+        } else {
+            ::std::this_thread::yield();
+        }
+    }
+
+    // Returns `true` if `pause()` has started to yield, which is a good time to block instead.
+    bool is_yielding() const noexcept {
+        return count_ >= spin_limit;
+    }
+
+    void reset() noexcept {
+        count_ = 1u;
+    }
+
+private:
+    ::std::uint32_t count_ = 1u;
+};
+
+} // namespace flux::fou
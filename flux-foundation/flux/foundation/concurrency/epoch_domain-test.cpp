@@ -0,0 +1,154 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace flux::fou;
+
+namespace {
+
+struct [[nodiscard]] counted final {
+    explicit counted(int* destroyed) noexcept : destroyed_{destroyed} {}
+
+    ~counted() {
+        ++*destroyed_;
+    }
+
+    int* destroyed_;
+};
+
+} // namespace
+
+TEST_CASE("fou::epoch_domain", "[flux-concurrency/epoch_domain.hpp]") {
+    using memory_pool = flux::fou::memory_pool<>;
+
+    memory_pool  pool{sizeof(counted), memory_pool::min_block_size(sizeof(counted), 256u)};
+    int          destroyed = 0;
+    epoch_domain domain;
+
+    auto const create = [&] {
+        return ::new (allocator_traits<memory_pool>::allocate_node(pool, sizeof(counted),
+                                                                   alignof(counted)))
+                counted{&destroyed};
+    };
+
+    SECTION("grace period") {
+        epoch_participant writer{domain};
+        epoch_participant reader{domain};
+
+        reader.pin();
+        {
+            epoch_participant::guard guard{writer};
+            writer.retire(create(), pool);
+        }
+        CHECK(writer.retired_count() == 1u);
+
+        // The reader may still see the object, it stops the epoch after one step.
+        for (int i = 0; i < 4; ++i)
+            writer.collect();
+        CHECK(destroyed == 0);
+        CHECK(domain.epoch() == 1u);
+
+        reader.unpin();
+        writer.collect();
+        writer.collect();
+        CHECK(destroyed == 1);
+        CHECK(writer.retired_count() == 0u);
+    }
+    SECTION("nested pins") {
+        epoch_participant participant{domain};
+        participant.pin();
+        participant.pin();
+        participant.unpin();
+        CHECK(participant.is_pinned());
+        participant.unpin();
+        CHECK_FALSE(participant.is_pinned());
+    }
+    SECTION("batches") {
+        // Retiring many objects reclaims the older ones on the way.
+        epoch_participant participant{domain};
+        for (auto i = 0u; i < 10u * epoch_participant::collect_threshold; ++i) {
+            epoch_participant::guard guard{participant};
+            participant.retire(create(), pool);
+        }
+        CHECK(destroyed > 0);
+        CHECK(participant.retired_count() < 3u * epoch_participant::collect_threshold);
+    }
+    SECTION("orphans") {
+        epoch_participant reader{domain};
+        reader.pin();
+        {
+            epoch_participant writer{domain};
+            for (int i = 0; i < 100; ++i)
+                writer.retire(create(), pool);
+        }
+        CHECK(destroyed < 100);
+
+        // The objects of the writer are reclaimed by the domain.
+        reader.unpin();
+        domain.try_advance();
+        domain.try_advance();
+        domain.try_advance();
+        CHECK(destroyed == 100);
+    }
+}
+
+TEST_CASE("fou::epoch_domain concurrent", "[flux-concurrency/epoch_domain.hpp]") {
+    struct [[nodiscard]] node final {
+        ~node() {
+            alive = 0;
+        }
+
+        int value;
+        int alive;
+    };
+
+    constexpr int iterations = 2000;
+
+    epoch_domain      domain;
+    default_allocator heap;
+
+    auto const create = [&](int value) {
+        using traits = allocator_traits<default_allocator>;
+        return ::new (traits::allocate_node(heap, sizeof(node), alignof(node))) node{value, 1};
+    };
+
+    ::std::atomic<node*> shared{create(0)};
+    ::std::atomic<bool>  done{false};
+    ::std::atomic<int>   invalid{0};
+
+    ::std::vector<::std::thread> readers;
+    for (int t = 0; t < 2; ++t) {
+        readers.emplace_back([&] {
+            epoch_participant participant{domain};
+            while (!done.load(::std::memory_order_relaxed)) {
+                epoch_participant::guard guard{participant};
+                auto* current = shared.load(::std::memory_order_acquire);
+                if (current->alive != 1)
+                    invalid.fetch_add(1, ::std::memory_order_relaxed);
+                ::std::this_thread::yield();
+            }
+        });
+    }
+
+    {
+        epoch_participant writer{domain};
+        for (int i = 1; i <= iterations; ++i) {
+            epoch_participant::guard guard{writer};
+            auto* previous = shared.exchange(create(i), ::std::memory_order_acq_rel);
+            writer.retire(previous, heap);
+        }
+        done.store(true, ::std::memory_order_relaxed);
+        for (auto& reader : readers)
+            reader.join();
+    }
+
+    CHECK(invalid.load() == 0);
+    auto* last = shared.load();
+    CHECK(last->value == iterations);
+    ::std::destroy_at(last);
+    allocator_traits<default_allocator>::deallocate_node(heap, last, sizeof(node), alignof(node));
+}
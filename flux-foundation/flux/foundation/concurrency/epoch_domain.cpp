@@ -0,0 +1,195 @@
+#include <flux/foundation/concurrency/epoch_domain.hpp>
+
+#include <mutex>
+
+namespace flux::fou {
+
+namespace {
+
+constexpr ::std::size_t blocks_per_chunk = 16u;
+
+// Reclaims the objects of the `blocks` and returns how many they were.
+::std::size_t reclaim_objects(detail::retired_block* blocks) noexcept {
+    ::std::size_t count = 0u;
+    for (auto* block = blocks; block; block = block->next) {
+        for (::std::size_t i = 0u; i < block->count; ++i) {
+            auto& retired = block->objects[i];
+            retired.reclaim(retired.context, retired.object);
+        }
+        count += block->count;
+    }
+    return count;
+}
+
+detail::retired_block* last_block(detail::retired_block* blocks) noexcept {
+    while (blocks->next)
+        blocks = blocks->next;
+    return blocks;
+}
+
+} // namespace
+
+epoch_domain::epoch_domain() noexcept
+        : blocks_{sizeof(detail::retired_block),
+                  memory_pool<>::min_block_size(sizeof(detail::retired_block), blocks_per_chunk)} {}
+
+epoch_domain::~epoch_domain() {
+    FLUX_ASSERT(!participants_, "epoch_domain destroyed while it has participants");
+
+    for (auto* block = orphans_; block;) {
+        auto* next = block->next;
+        block->next = nullptr;
+        reclaim_objects(block);
+        blocks_.deallocate_node(block);
+        block = next;
+    }
+}
+
+bool epoch_domain::try_advance() noexcept {
+    ::std::lock_guard<adaptive_mutex> guard{mutex_};
+
+    auto epoch = epoch_.load(::std::memory_order_relaxed);
+    // Pairs with the fence in `pin()`: either the participant sees the new epoch, or we see that
+    // it is pinned in the old one.
+    ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+    for (auto* participant = participants_; participant; participant = participant->next_) {
+        auto const state = participant->state_.load(::std::memory_order_acquire);
+        if ((state & epoch_participant::pinned) && (state >> 1u) != epoch)
+            return false;
+    }
+
+    epoch_.store(++epoch, ::std::memory_order_release);
+    reclaim_orphans(epoch);
+    return true;
+}
+
+void epoch_domain::attach(epoch_participant& participant) noexcept {
+    ::std::lock_guard<adaptive_mutex> guard{mutex_};
+    participant.next_ = participants_;
+    participants_     = &participant;
+}
+
+void epoch_domain::detach(epoch_participant& participant, detail::retired_block* retired,
+                          detail::retired_block* free) noexcept {
+    ::std::lock_guard<adaptive_mutex> guard{mutex_};
+    for (auto** link = &participants_; *link; link = &(*link)->next_) {
+        if (*link == &participant) {
+            *link = participant.next_;
+            break;
+        }
+    }
+
+    if (retired) {
+        last_block(retired)->next = orphans_;
+        orphans_                  = retired;
+    }
+    while (free) {
+        auto* next = free->next;
+        blocks_.deallocate_node(free);
+        free = next;
+    }
+}
+
+detail::retired_block* epoch_domain::allocate_block() noexcept {
+    ::std::lock_guard<adaptive_mutex> guard{mutex_};
+    return static_cast<detail::retired_block*>(blocks_.allocate_node());
+}
+
+void epoch_domain::reclaim_orphans(epoch_type epoch) noexcept {
+    for (auto** link = &orphans_; *link;) {
+        auto* block = *link;
+        if (block->epoch + 2u > epoch) {
+            link = &block->next;
+            continue;
+        }
+
+        *link       = block->next;
+        block->next = nullptr;
+        reclaim_objects(block);
+        blocks_.deallocate_node(block);
+    }
+}
+
+epoch_participant::epoch_participant(epoch_domain& domain) noexcept : domain_{&domain} {
+    domain_->attach(*this);
+}
+
+epoch_participant::~epoch_participant() {
+    FLUX_ASSERT(!is_pinned(), "epoch_participant destroyed while it is pinned");
+    collect();
+
+    // Whatever is not safe yet is left to the domain, in a single chain.
+    detail::retired_block* retired = nullptr;
+    for (auto*& blocks : limbo_) {
+        if (blocks) {
+            last_block(blocks)->next = retired;
+            retired                  = blocks;
+            blocks                   = nullptr;
+        }
+    }
+    domain_->detach(*this, retired, free_);
+}
+
+void epoch_participant::pin() noexcept {
+    if (depth_++ != 0u)
+        return;
+
+    auto const epoch = domain_->epoch_.load(::std::memory_order_relaxed);
+    state_.store((epoch << 1u) | pinned, ::std::memory_order_relaxed);
+    // The announcement must be visible before the structure is read.
+    ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+}
+
+void epoch_participant::unpin() noexcept {
+    FLUX_ASSERT(is_pinned());
+    if (--depth_ == 0u)
+        state_.store(0u, ::std::memory_order_release);
+}
+
+void epoch_participant::retire(void* object, void (*reclaim_object)(void*, void*) noexcept,
+                               void* context) noexcept {
+    auto const epoch  = domain_->epoch_.load(::std::memory_order_seq_cst);
+    auto&      blocks = limbo_[epoch % limbo_count];
+
+    // The list was filled at least three epochs ago, it is safe by now.
+    if (blocks && blocks->epoch != epoch)
+        reclaim(blocks);
+
+    if (!blocks || blocks->count == detail::retired_block::capacity) {
+        auto* block = free_;
+        if (block)
+            free_ = block->next;
+        else
+            block = domain_->allocate_block();
+
+        block->next  = blocks;
+        block->epoch = epoch;
+        block->count = 0u;
+        blocks       = block;
+    }
+    blocks->objects[blocks->count++] = {object, reclaim_object, context};
+    ++retired_count_;
+
+    if (++since_collect_ >= collect_threshold)
+        collect();
+}
+
+void epoch_participant::collect() noexcept {
+    since_collect_ = 0u;
+    domain_->try_advance();
+
+    auto const epoch = domain_->epoch_.load(::std::memory_order_acquire);
+    for (auto*& blocks : limbo_) {
+        if (blocks && blocks->epoch + 2u <= epoch)
+            reclaim(blocks);
+    }
+}
+
+void epoch_participant::reclaim(detail::retired_block*& blocks) noexcept {
+    retired_count_ -= reclaim_objects(blocks);
+    last_block(blocks)->next = free_;
+    free_                    = blocks;
+    blocks                   = nullptr;
+}
+
+} // namespace flux::fou
@@ -0,0 +1,189 @@
+#pragma once
+#include <flux/foundation/concurrency/mutex.hpp>
+#include <flux/foundation/memory/default_allocator.hpp>
+#include <flux/foundation/memory/memory_arena.hpp>
+#include <flux/foundation/memory/memory_pool.hpp>
+#include <flux/foundation/utility/addressof.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace flux::fou {
+
+class [[nodiscard]] epoch_domain;
+class [[nodiscard]] epoch_participant;
+
+namespace detail {
+
+struct [[nodiscard]] retired_object final {
+    void* object;
+    void (*reclaim)(void* context, void* object) noexcept;
+    void* context;
+};
+
+// The objects a thread has retired during one epoch, chained when there are more of them.
+struct [[nodiscard]] retired_block final {
+    static constexpr ::std::size_t capacity = 40u;
+
+    retired_block*  next;
+    ::std::uint64_t epoch;
+    ::std::size_t   count;
+    retired_object  objects[capacity];
+};
+
+} // namespace detail
+
+// A domain of epoch-based reclamation for lock-free data structures. A node that has been unlinked
+// from a structure may still be read by threads that found it before, so it is retired instead of
+// freed, and reclaimed once every thread that could have seen it has left its critical section.
+// Threads take part through an `epoch_participant`, which announces the epoch it has observed
+// when it is pinned. The global epoch only advances when every pinned participant has observed
+// it, so objects retired in an epoch are safe to reclaim two epochs later.
+// NOTE:
+//  A participant that stays pinned forever stops the reclamation of the whole domain.
+class [[nodiscard]] epoch_domain {
+public:
+    using epoch_type = ::std::uint64_t;
+    using size_type  = ::std::size_t;
+
+    epoch_domain() noexcept;
+
+    // There must be no participants left, the objects they have left behind are reclaimed.
+    ~epoch_domain();
+
+    epoch_domain(epoch_domain const&)            = delete;
+    epoch_domain& operator=(epoch_domain const&) = delete;
+
+    epoch_type epoch() const noexcept {
+        return epoch_.load(::std::memory_order_acquire);
+    }
+
+    // Advances the global epoch if every pinned participant has observed the current one.
+    // Returns `false` if a participant is still behind.
+    bool try_advance() noexcept;
+
+private:
+    friend epoch_participant;
+
+    void attach(epoch_participant& participant) noexcept;
+
+    // Takes over the objects the `participant` could not reclaim yet, and its free blocks.
+    void detach(epoch_participant& participant, detail::retired_block* retired,
+                detail::retired_block* free) noexcept;
+
+    detail::retired_block* allocate_block() noexcept;
+
+    // Reclaims the objects left behind by detached participants that are safe by now.
+    void reclaim_orphans(epoch_type epoch) noexcept;
+
+    alignas(cache_line_size) ::std::atomic<epoch_type> epoch_{0u};
+
+    alignas(cache_line_size) adaptive_mutex mutex_;
+    epoch_participant*                      participants_ = nullptr;
+    detail::retired_block*                  orphans_      = nullptr;
+    memory_pool<>                           blocks_;
+};
+
+// The membership of a thread in an `epoch_domain`. It is created by the thread and must only be
+// used by it, e.g. as a member of a worker or as a `thread_local`.
+// A thread pins its participant while it reads a lock-free structure, and retires the nodes it
+// unlinks. Retired objects are reclaimed by the participant that has retired them, in batches of
+// `collect_threshold`, or by the domain once the participant is gone.
+class [[nodiscard]] epoch_participant {
+public:
+    using epoch_type = epoch_domain::epoch_type;
+    using size_type  = ::std::size_t;
+
+    static constexpr size_type collect_threshold = 64u;
+
+    // Keeps the participant pinned while it is alive, pins can be nested.
+    class [[nodiscard]] guard {
+    public:
+        explicit guard(epoch_participant& participant) noexcept : participant_{&participant} {
+            participant_->pin();
+        }
+
+        ~guard() {
+            participant_->unpin();
+        }
+
+        guard(guard const&)            = delete;
+        guard& operator=(guard const&) = delete;
+
+    private:
+        epoch_participant* participant_;
+    };
+
+    explicit epoch_participant(epoch_domain& domain) noexcept;
+
+    ~epoch_participant();
+
+    epoch_participant(epoch_participant const&)            = delete;
+    epoch_participant& operator=(epoch_participant const&) = delete;
+
+    // Enters a critical section, nodes read from a lock-free structure of the domain stay valid
+    // until the matching `unpin()`.
+    void pin() noexcept;
+
+    void unpin() noexcept;
+
+    bool is_pinned() const noexcept {
+        return depth_ != 0u;
+    }
+
+    // Destroys the `object` and returns it to the `allocator` once no thread can read it anymore.
+    // The `object` must already be unreachable for threads that pin from now on.
+    template <typename T, raw_allocator RawAllocator>
+    void retire(T* object, RawAllocator& allocator) noexcept {
+        using traits = allocator_traits<RawAllocator>;
+
+        retire(object, [](void* context, void* node) noexcept {
+            ::std::destroy_at(static_cast<T*>(node));
+            if constexpr (is_stateful_allocator<RawAllocator>::value) {
+                traits::deallocate_node(*static_cast<RawAllocator*>(context), node, sizeof(T),
+                                        alignof(T));
+            } else {
+                (void)context;
+                RawAllocator stateless;
+                traits::deallocate_node(stateless, node, sizeof(T), alignof(T));
+            }
+        }, fou::addressof(allocator));
+    }
+
+    // Calls `reclaim(context, object)` once no thread can read the `object` anymore.
+    void retire(void* object, void (*reclaim)(void* context, void* object) noexcept,
+                void* context) noexcept;
+
+    // Tries to advance the epoch and reclaims the retired objects that are safe by now.
+    void collect() noexcept;
+
+    // Returns the number of retired objects that have not been reclaimed yet.
+    size_type retired_count() const noexcept {
+        return retired_count_;
+    }
+
+private:
+    friend epoch_domain;
+
+    static constexpr epoch_type pinned = 1u;
+
+    // The objects retired in epoch `e` are kept in `limbo_[e % 3]`, which is safe to reclaim when
+    // the global epoch is `e + 2`, so it can be reused for `e + 3`.
+    static constexpr size_type limbo_count = 3u;
+
+    void reclaim(detail::retired_block*& blocks) noexcept;
+
+    epoch_domain* domain_;
+    // The epoch observed by the last outermost `pin()`, shifted by one, and `pinned`.
+    alignas(cache_line_size) ::std::atomic<epoch_type> state_{0u};
+    epoch_participant* next_  = nullptr;
+    size_type          depth_ = 0u;
+
+    detail::retired_block* limbo_[limbo_count] = {};
+    detail::retired_block* free_               = nullptr;
+    size_type              retired_count_      = 0u;
+    size_type              since_collect_      = 0u;
+};
+
+} // namespace flux::fou
@@ -0,0 +1,92 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <vector>
+
+using namespace flux::fou;
+
+namespace {
+
+::std::uint64_t fibonacci(job_system& jobs, ::std::uint64_t n) noexcept {
+    if (n < 2u)
+        return n;
+
+    // Forks one half and runs the other one inline, like a fork-join task.
+    ::std::uint64_t first = 0u;
+    job_counter     children;
+    jobs.run([&] { first = fibonacci(jobs, n - 1u); }, children);
+    auto const second = fibonacci(jobs, n - 2u);
+    jobs.wait(children);
+    return first + second;
+}
+
+} // namespace
+
+TEST_CASE("fou::job_system", "[flux-concurrency/job_system.hpp]") {
+    job_system_config config;
+    config.worker_count = 4u;
+    job_system jobs{config};
+    CHECK(jobs.worker_count() == 4u);
+    CHECK(jobs.worker_index() == 0u);
+
+    SECTION("jobs") {
+        ::std::atomic<int> sum{0};
+        job_counter        counter;
+        // More jobs than slots, the submitting worker helps to free them.
+        for (int i = 0; i < 5000; ++i)
+            jobs.run([&sum, i] { sum.fetch_add(i, ::std::memory_order_relaxed); }, counter);
+        jobs.wait(counter);
+        CHECK(counter.is_done());
+        CHECK(sum.load() == 5000 * 4999 / 2);
+    }
+    SECTION("fork-join") {
+        CHECK(fibonacci(jobs, 20u) == 6765u);
+    }
+    SECTION("parallel_for") {
+        // Catch isn't thread-safe, so the jobs only record what is checked afterwards.
+        ::std::vector<int>                 values(10000, 1);
+        ::std::vector<::std::atomic<bool>> seen(jobs.worker_count() + 1u);
+        jobs.parallel_for(values.size(), 64u, [&](::std::size_t first, ::std::size_t last) {
+            auto const index = jobs.worker_index();
+            seen[index < jobs.worker_count() ? index : jobs.worker_count()].store(true);
+            for (auto i = first; i < last; ++i)
+                values[i] *= 2;
+        });
+        auto sum = 0;
+        for (auto value : values)
+            sum += value;
+        CHECK(sum == 20000);
+        CHECK(seen.back().load() == false);
+    }
+    SECTION("temporary allocations") {
+        ::std::atomic<int> allocated{0};
+        job_counter        counter;
+        for (int i = 0; i < 64; ++i) {
+            jobs.run(
+                    [&allocated] {
+                        temporary_allocator allocator;
+                        auto* memory = static_cast<int*>(allocator.allocate(sizeof(int) * 64u,
+                                                                            alignof(int)));
+                        if (memory) {
+                            memory[63] = 1;
+                            allocated.fetch_add(memory[63]);
+                        }
+                    },
+                    counter);
+        }
+        jobs.wait(counter);
+        CHECK(allocated.load() == 64);
+    }
+}
+
+TEST_CASE("fou::job_system nested", "[flux-concurrency/job_system.hpp]") {
+    job_system outer{job_system_config{2u, false}};
+    {
+        job_system inner{job_system_config{2u, false}};
+        CHECK(inner.worker_index() == 0u);
+        CHECK(outer.worker_index() == job_system::npos);
+    }
+    CHECK(outer.worker_index() == 0u);
+}
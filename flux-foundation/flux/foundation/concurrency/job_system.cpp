@@ -0,0 +1,238 @@
+#include <flux/foundation/concurrency/backoff.hpp>
+#include <flux/foundation/concurrency/job_system.hpp>
+
+#if FLUX_TARGET(WINDOWS)
+#    include <flux/platform/win32/api.hpp>
+
+#    include <bit>
+#elif FLUX_TARGET(LINUX)
+#    include <pthread.h>
+#    include <sched.h>
+#endif
+
+namespace flux::fou {
+
+namespace detail {
+
+struct [[nodiscard]] alignas(cache_line_size) job_worker final {
+    work_stealing_deque<job*, job_system::max_jobs> deque;
+    job                                             jobs[job_system::max_jobs];
+    ::std::size_t                                   next_job = 0u;
+    ::std::size_t                                   index    = 0u;
+    ::std::uint32_t                                 seed     = 1u;
+    job_system*                                     system   = nullptr;
+    // The worker the creating thread was before, job systems can be nested.
+    job_worker*                                     previous = nullptr;
+    ::std::thread                                   thread;
+};
+
+} // namespace detail
+
+namespace {
+
+thread_local detail::job_worker* current_worker = nullptr;
+
+::std::uint32_t next_random(::std::uint32_t& state) noexcept {
+    // xorshift32, good enough to spread the thieves over the victims.
+    state ^= state << 13u;
+    state ^= state >> 17u;
+    state ^= state << 5u;
+    return state;
+}
+
+// Pins the calling thread to the `index`-th hardware thread the process is allowed to run on.
+void pin_thread(::std::size_t index) noexcept {
+#if FLUX_TARGET(LINUX)
+    cpu_set_t allowed;
+    if (::sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+        return;
+
+    auto const count = static_cast<::std::size_t>(CPU_COUNT(&allowed));
+    if (count == 0u)
+        return;
+
+    auto nth = index % count;
+    for (::std::size_t cpu = 0u; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &allowed) && nth-- == 0u) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
+            return;
+        }
+    }
+#elif FLUX_TARGET(WINDOWS)
+    ::std::uintptr_t allowed = 0u;
+    ::std::uintptr_t system  = 0u;
+    if (win32::GetProcessAffinityMask(win32::GetCurrentProcess(), &allowed, &system) == 0)
+        return;
+
+    auto const count = static_cast<::std::size_t>(::std::popcount(allowed));
+    if (count == 0u)
+        return;
+
+    auto nth = index % count;
+    for (::std::size_t cpu = 0u; cpu < sizeof(::std::uintptr_t) * 8u; ++cpu) {
+        auto const mask = ::std::uintptr_t(1) << cpu;
+        if ((allowed & mask) != 0u && nth-- == 0u) {
+            win32::SetThreadAffinityMask(win32::GetCurrentThread(), mask);
+            return;
+        }
+    }
+#else
+    // There is no affinity API on macOS, the scheduler only takes hints.
+    (void)index;
+#endif
+}
+
+} // namespace
+
+job_system::job_system(job_system_config const& config) noexcept
+        : config_{config}, worker_count_{config.worker_count} {
+    if (worker_count_ == 0u) {
+        worker_count_ = ::std::thread::hardware_concurrency();
+        if (worker_count_ == 0u)
+            worker_count_ = 1u;
+    }
+
+    workers_.reset(new detail::job_worker[worker_count_]);
+    for (size_type i = 0u; i < worker_count_; ++i) {
+        auto& worker  = workers_[i];
+        worker.index  = i;
+        worker.seed   = static_cast<::std::uint32_t>(i + 1u);
+        worker.system = this;
+    }
+
+    auto& main     = workers_[0];
+    main.previous  = current_worker;
+    current_worker = &main;
+    for (size_type i = 1u; i < worker_count_; ++i)
+        workers_[i].thread = ::std::thread{[this, i] { run_worker(i); }};
+}
+
+job_system::~job_system() {
+    FLUX_ASSERT(current_worker == &workers_[0]);
+
+    is_running_.store(false, ::std::memory_order_seq_cst);
+    epoch_.fetch_add(1u, ::std::memory_order_seq_cst);
+    epoch_.notify_all();
+    for (size_type i = 1u; i < worker_count_; ++i)
+        workers_[i].thread.join();
+
+    current_worker = workers_[0].previous;
+}
+
+void job_system::wait(job_counter& counter) noexcept {
+    FLUX_ASSERT(worker_index() != npos);
+
+    auto& worker = *current_worker;
+    for (backoff spin; !counter.is_done();) {
+        if (try_run_one(worker))
+            spin.reset();
+        else
+            spin.pause();
+    }
+}
+
+job_system::size_type job_system::worker_index() const noexcept {
+    if (current_worker && current_worker->system == this)
+        return current_worker->index;
+    return npos;
+}
+
+void job_system::execute(detail::job& job) noexcept {
+    // The job releases its slot, so the counter has to be read before.
+    auto* counter = job.counter;
+    job.invoke(job);
+    counter->value_.fetch_sub(1u, ::std::memory_order_release);
+}
+
+detail::job& job_system::acquire_job() noexcept {
+    FLUX_ASSERT(worker_index() != npos);
+
+    auto& worker = *current_worker;
+    auto& job    = worker.jobs[worker.next_job++ & (max_jobs - 1u)];
+    // The slot still holds a job that hasn't started, help until it has.
+    for (backoff spin; job.is_busy.load(::std::memory_order_acquire);) {
+        if (!try_run_one(worker))
+            spin.pause();
+    }
+    job.is_busy.store(true, ::std::memory_order_relaxed);
+    return job;
+}
+
+void job_system::submit(detail::job& job) noexcept {
+    if (!current_worker->deque.push(&job)) {
+        execute(job);
+        return;
+    }
+
+    // Pairs with the fence in `sleep()`: either the sleeper sees the job, or we see the sleeper.
+    ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+    if (sleepers_.load(::std::memory_order_relaxed) != 0u) {
+        epoch_.fetch_add(1u, ::std::memory_order_seq_cst);
+        epoch_.notify_one();
+    }
+}
+
+bool job_system::try_run_one(detail::job_worker& worker) noexcept {
+    detail::job* job = nullptr;
+    if (!worker.deque.pop(job)) {
+        auto const first = next_random(worker.seed) % worker_count_;
+        auto       found = false;
+        for (size_type i = 0u; i < worker_count_ && !found; ++i) {
+            auto& victim = workers_[(first + i) % worker_count_];
+            if (&victim != &worker)
+                found = victim.deque.steal(job);
+        }
+        if (!found)
+            return false;
+    }
+
+    execute(*job);
+    return true;
+}
+
+void job_system::run_worker(size_type index) noexcept {
+    // Creates the per-thread stack before the first job, so that jobs get their scratch memory
+    // without having to create it.
+    temporary_stack_initializer initializer{config_.temporary_stack_size};
+
+    auto& worker   = workers_[index];
+    current_worker = &worker;
+    if (config_.pin_workers)
+        pin_thread(index);
+
+    backoff spin;
+    while (is_running_.load(::std::memory_order_acquire)) {
+        if (try_run_one(worker)) {
+            spin.reset();
+        } else if (!spin.is_yielding()) {
+            spin.pause();
+        } else {
+            sleep();
+            spin.reset();
+        }
+    }
+    current_worker = nullptr;
+}
+
+void job_system::sleep() noexcept {
+    sleepers_.fetch_add(1u, ::std::memory_order_relaxed);
+    ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+    // A job submitted after the epoch has been read changes it, so the wait returns immediately.
+    auto const epoch = epoch_.load(::std::memory_order_seq_cst);
+    if (is_running_.load(::std::memory_order_seq_cst) && !has_jobs())
+        epoch_.wait(epoch, ::std::memory_order_seq_cst);
+    sleepers_.fetch_sub(1u, ::std::memory_order_relaxed);
+}
+
+bool job_system::has_jobs() const noexcept {
+    for (size_type i = 0u; i < worker_count_; ++i) {
+        if (!workers_[i].deque.empty())
+            return true;
+    }
+    return false;
+}
+
+} // namespace flux::fou
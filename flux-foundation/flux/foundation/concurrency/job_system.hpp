@@ -0,0 +1,175 @@
+#pragma once
+#include <flux/foundation/concurrency/work_stealing_deque.hpp>
+#include <flux/foundation/memory/temporary_allocator.hpp>
+#include <flux/foundation/utility/launder.hpp>
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <thread>
+
+namespace flux::fou {
+
+class [[nodiscard]] job_system;
+
+// Counts the unfinished jobs of a fork-join group. Every job started with the counter increments
+// it and decrements it once it has finished, `job_system::wait()` returns when it reaches zero.
+// A job can fork children with a counter of its own and wait for them, which makes the counter
+// of the parent job stay above zero until all of its children are done.
+// NOTE:
+//  The counter must outlive the jobs started with it, so it is usually waited for before the scope
+//  declaring it is left.
+class [[nodiscard]] job_counter {
+public:
+    using size_type = ::std::size_t;
+
+    job_counter() noexcept = default;
+
+    job_counter(job_counter const&)            = delete;
+    job_counter& operator=(job_counter const&) = delete;
+
+    bool is_done() const noexcept {
+        return value_.load(::std::memory_order_acquire) == 0u;
+    }
+
+    // Returns the number of unfinished jobs, it is only a snapshot.
+    size_type value() const noexcept {
+        return value_.load(::std::memory_order_relaxed);
+    }
+
+private:
+    ::std::atomic<size_type> value_{0u};
+
+    friend job_system;
+};
+
+namespace detail {
+
+struct [[nodiscard]] job_worker;
+
+// A type-erased job. The callable is stored inline, so that starting a job never allocates.
+struct [[nodiscard]] alignas(cache_line_size) job final {
+    static constexpr ::std::size_t storage_size = cache_line_size - 2u * sizeof(void*) - 16u;
+
+    using invoke_function = void (*)(job& self) noexcept;
+
+    invoke_function     invoke  = nullptr;
+    job_counter*        counter = nullptr;
+    ::std::atomic<bool> is_busy{false};
+
+    alignas(16) ::std::byte storage[storage_size];
+};
+
+} // namespace detail
+
+// Configures a `job_system`.
+struct [[nodiscard]] job_system_config final {
+    // The number of workers including the thread creating the system, zero uses one per hardware
+    // thread.
+    ::std::size_t worker_count = 0u;
+    // Pins every worker to a hardware thread, so that its caches stay warm.
+    bool pin_workers = true;
+    // The initial size of the `temporary_stack` of every worker thread.
+    ::std::size_t temporary_stack_size = temporary_stack_initializer::default_stack_size;
+};
+
+// A work-stealing job scheduler. Every worker owns a `work_stealing_deque`, jobs are pushed to and
+// popped from the deque of the calling worker, and idle workers steal from the others. The thread
+// creating the system is worker zero and only runs jobs while it waits for a `job_counter`.
+// Each worker thread creates its per-thread `temporary_stack` up front, so a `temporary_allocator`
+// inside of a job doesn't allocate from the heap once the stack has settled, and jobs never
+// allocate either: their callables are stored in a fixed ring of slots per worker.
+// NOTE:
+// - Jobs can only be started and waited for by the workers, i.e. from the thread that created the
+//   system or from inside of jobs, and the system must be destroyed by the thread that created it.
+// - A callable must fit into `max_job_size` bytes, bigger state should be captured by reference.
+// - A worker cannot have more than `max_jobs` jobs that haven't started yet, starting another
+//   one runs queued jobs until a slot is free.
+class [[nodiscard]] job_system {
+public:
+    using size_type = ::std::size_t;
+
+    static constexpr size_type max_jobs     = 1024u;
+    static constexpr size_type max_job_size = detail::job::storage_size;
+    static constexpr size_type npos         = size_type(-1);
+
+    explicit job_system(job_system_config const& config = {}) noexcept;
+
+    ~job_system();
+
+    job_system(job_system const&)            = delete;
+    job_system& operator=(job_system const&) = delete;
+
+    // Starts a job that calls `function()` and increments the `counter` until it has finished.
+    template <typename Function>
+    void run(Function&& function, job_counter& counter) noexcept {
+        using callable = meta::decay_t<Function>;
+        static_assert(sizeof(callable) <= max_job_size && alignof(callable) <= 16u,
+                      "The callable doesn't fit into a job, capture its state by reference.");
+        static_assert(meta::nothrow_move_constructible<callable>);
+
+        auto& job = acquire_job();
+        ::new (static_cast<void*>(job.storage)) callable(::std::forward<Function>(function));
+        job.invoke = [](detail::job& self) noexcept {
+            auto* stored = launder(reinterpret_cast<callable*>(self.storage));
+            // The slot is released before the call, a job may start more jobs than there are slots.
+            callable local{::std::move(*stored)};
+            stored->~callable();
+            self.is_busy.store(false, ::std::memory_order_release);
+            local();
+        };
+        job.counter = &counter;
+        counter.value_.fetch_add(1u, ::std::memory_order_relaxed);
+        submit(job);
+    }
+
+    // Calls `function(first, last)` for consecutive ranges of at most `grain_size` indices covering
+    // `[0, count)` in parallel and returns once all of them have finished.
+    template <typename Function>
+    void parallel_for(size_type count, size_type grain_size, Function&& function) noexcept {
+        FLUX_ASSERT(grain_size > 0u);
+
+        job_counter counter;
+        for (size_type first = 0u; first < count; first += grain_size) {
+            auto const last = count - first < grain_size ? count : first + grain_size;
+            run([&function, first, last] { function(first, last); }, counter);
+        }
+        wait(counter);
+    }
+
+    // Runs jobs until the `counter` reaches zero.
+    void wait(job_counter& counter) noexcept;
+
+    size_type worker_count() const noexcept {
+        return worker_count_;
+    }
+
+    // Returns the index of the calling worker or `npos` if the calling thread isn't one of ours.
+    size_type worker_index() const noexcept;
+
+private:
+    static void execute(detail::job& job) noexcept;
+
+    detail::job& acquire_job() noexcept;
+
+    void submit(detail::job& job) noexcept;
+
+    // Runs a job of the calling worker or steals one, returns `false` if there was none.
+    bool try_run_one(detail::job_worker& worker) noexcept;
+
+    void run_worker(size_type index) noexcept;
+
+    // Blocks the calling worker until a job is submitted or the system is destroyed.
+    void sleep() noexcept;
+
+    bool has_jobs() const noexcept;
+
+    job_system_config                       config_;
+    size_type                               worker_count_;
+    ::std::unique_ptr<detail::job_worker[]> workers_;
+    ::std::atomic<::std::uint32_t>          epoch_{0u};
+    ::std::atomic<::std::uint32_t>          sleepers_{0u};
+    ::std::atomic<bool>                     is_running_{true};
+};
+
+} // namespace flux::fou
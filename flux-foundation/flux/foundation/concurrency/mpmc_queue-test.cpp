@@ -0,0 +1,88 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace flux::fou;
+
+TEST_CASE("fou::mpmc_queue", "[flux-concurrency/mpmc_queue.hpp]") {
+    mpmc_queue<int> queue{4u};
+    CHECK(queue.capacity() == 4u);
+    CHECK(queue.empty());
+
+    int value = 0;
+    CHECK_FALSE(queue.pop(value));
+
+    for (int i = 0; i < 4; ++i)
+        CHECK(queue.push(i));
+    CHECK_FALSE(queue.push(4));
+    CHECK(queue.size() == 4u);
+
+    // The ring wraps around.
+    for (int lap = 0; lap < 3; ++lap) {
+        CHECK(queue.pop(value));
+        CHECK(value == lap);
+        CHECK(queue.push(lap + 4));
+    }
+
+    int values[8] = {};
+    CHECK(queue.pop(values, 8u) == 4u);
+    for (int i = 0; i < 4; ++i)
+        CHECK(values[i] == i + 3);
+
+    int pushed[] = {1, 2, 3, 4, 5};
+    CHECK(queue.push(pushed, 5u) == 4u);
+    CHECK(queue.size() == 4u);
+
+    SECTION("single slot") {
+        mpmc_queue<int> single{1u};
+        CHECK(single.capacity() == 1u);
+        for (int lap = 0; lap < 3; ++lap) {
+            CHECK(single.push(lap));
+            CHECK_FALSE(single.push(lap + 1));
+            CHECK(single.pop(value));
+            CHECK(value == lap);
+            CHECK_FALSE(single.pop(value));
+        }
+    }
+}
+
+TEST_CASE("fou::mpmc_queue concurrent", "[flux-concurrency/mpmc_queue.hpp]") {
+    constexpr int thread_count = 4;
+    constexpr int count        = 50000;
+
+    mpmc_queue<int>                   queue{128u};
+    ::std::vector<::std::atomic<int>> taken(thread_count * count);
+    ::std::atomic<int>                remaining{thread_count * count};
+
+    ::std::vector<::std::thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < count;) {
+                if (queue.push(t * count + i))
+                    ++i;
+            }
+        });
+        threads.emplace_back([&] {
+            int value = 0;
+            while (remaining.load(::std::memory_order_relaxed) > 0) {
+                if (queue.pop(value)) {
+                    taken[static_cast<::std::size_t>(value)].fetch_add(1,
+                                                                       ::std::memory_order_relaxed);
+                    remaining.fetch_sub(1, ::std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    auto once = true;
+    for (auto& count_taken : taken)
+        once = once && count_taken.load() == 1;
+    CHECK(once);
+    CHECK(queue.empty());
+}
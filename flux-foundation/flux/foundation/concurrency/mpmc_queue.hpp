@@ -0,0 +1,163 @@
+#pragma once
+#include <flux/foundation/memory/allocator_storage.hpp>
+#include <flux/foundation/memory/default_allocator.hpp>
+#include <flux/foundation/memory/uninitialized_storage.hpp>
+
+#include <atomic>
+#include <memory>
+
+namespace flux::fou {
+
+// A bounded lock-free ring buffer for any number of producer and consumer threads, after the
+// bounded MPMC queue of Dmitry Vyukov. Every slot has a sequence number that tells whether it is
+// ready to be written or read in the current lap, so producers and consumers only contend on
+// their own index and never on each other's. The sequence numbers count twice per position, a
+// slot is free for the position `p` at `2p` and written at `2p + 1`, so that even a single slot
+// tells a written value from a free slot of the next lap.
+// The capacity is rounded up to a power of two, the slots are allocated from the `RawAllocator`
+// and `T` is constructed in place, so it doesn't have to be default-constructible.
+// NOTE:
+//  It is not linearizable: a `pop()` may fail while a slower producer that started earlier is
+//  still writing its slot, even though values pushed after it are already visible.
+template <meta::nothrow_move_constructible T, raw_allocator RawAllocator = default_allocator>
+    requires meta::nothrow_move_assignable<T>
+class [[nodiscard]] mpmc_queue {
+    using allocator_reference = allocator_reference<RawAllocator>;
+
+    struct [[nodiscard]] slot_type final {
+        ::std::atomic<::std::size_t> sequence;
+        uninitialized_storage<T>     value;
+    };
+
+public:
+    using value_type      = T;
+    using allocator_type  = typename allocator_reference::allocator_type;
+    using size_type       = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+
+    explicit mpmc_queue(size_type capacity) noexcept
+        requires(not is_stateful_allocator<allocator_type>::value)
+            : mpmc_queue{capacity, allocator_type{}} {}
+
+    mpmc_queue(size_type capacity, allocator_reference allocator) noexcept
+            : mask_{(size_type{1} << ilog2_ceil(capacity)) - 1u}, allocator_{allocator} {
+        FLUX_ASSERT(capacity > 0u);
+        slots_ = static_cast<slot_type*>(
+                allocator_.allocate_array(mask_ + 1u, sizeof(slot_type), alignof(slot_type)));
+        for (size_type i = 0u; i <= mask_; ++i)
+            ::std::construct_at(&slots_[i].sequence, 2u * i);
+    }
+
+    ~mpmc_queue() {
+        auto const tail = tail_.load(::std::memory_order_relaxed);
+        for (auto head = head_.load(::std::memory_order_relaxed); head != tail; ++head)
+            ::std::destroy_at(slots_[head & mask_].value.data());
+        allocator_.deallocate_array(slots_, mask_ + 1u, sizeof(slot_type), alignof(slot_type));
+    }
+
+    mpmc_queue(mpmc_queue const&)            = delete;
+    mpmc_queue& operator=(mpmc_queue const&) = delete;
+
+    // Constructs a value at the back, returns `false` if the queue is full.
+    template <typename... Args>
+        requires meta::nothrow_constructible<T, Args...>
+    bool emplace(Args&&... args) noexcept {
+        auto tail = tail_.load(::std::memory_order_relaxed);
+        for (;;) {
+            auto&      slot     = slots_[tail & mask_];
+            auto const sequence = slot.sequence.load(::std::memory_order_acquire);
+            auto const lap      = static_cast<difference_type>(sequence - 2u * tail);
+            if (lap == 0) {
+                // The slot is free in this lap, claim it.
+                if (tail_.compare_exchange_weak(tail, tail + 1u, ::std::memory_order_relaxed)) {
+                    ::std::construct_at(slot.value.data(), ::std::forward<Args>(args)...);
+                    slot.sequence.store(2u * tail + 1u, ::std::memory_order_release);
+                    return true;
+                }
+            } else if (lap < 0) {
+                // The slot still holds the value of the previous lap.
+                return false;
+            } else {
+                tail = tail_.load(::std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool push(T const& value) noexcept
+        requires meta::nothrow_copy_constructible<T>
+    {
+        return emplace(value);
+    }
+
+    bool push(T&& value) noexcept {
+        return emplace(::std::move(value));
+    }
+
+    // Moves values of `[first, first + count)` to the back until the queue is full. Returns the
+    // number of values that were pushed.
+    size_type push(T* first, size_type count) noexcept {
+        size_type n = 0u;
+        while (n < count && emplace(::std::move(first[n])))
+            ++n;
+        return n;
+    }
+
+    // Moves the front value into `value`, returns `false` if the queue is empty.
+    bool pop(T& value) noexcept {
+        auto head = head_.load(::std::memory_order_relaxed);
+        for (;;) {
+            auto&      slot     = slots_[head & mask_];
+            auto const sequence = slot.sequence.load(::std::memory_order_acquire);
+            auto const lap      = static_cast<difference_type>(sequence - (2u * head + 1u));
+            if (lap == 0) {
+                // The slot has been written in this lap, claim it.
+                if (head_.compare_exchange_weak(head, head + 1u, ::std::memory_order_relaxed)) {
+                    auto* front = slot.value.data();
+                    value       = ::std::move(*front);
+                    ::std::destroy_at(front);
+                    slot.sequence.store(2u * (head + mask_ + 1u), ::std::memory_order_release);
+                    return true;
+                }
+            } else if (lap < 0) {
+                // The slot has not been written in this lap yet.
+                return false;
+            } else {
+                head = head_.load(::std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Moves values from the front to `[first, first + count)` until the queue is empty. Returns
+    // the number of values that were popped.
+    size_type pop(T* first, size_type count) noexcept {
+        size_type n = 0u;
+        while (n < count && pop(first[n]))
+            ++n;
+        return n;
+    }
+
+    // Returns the number of values, it is only a snapshot if other threads access the queue.
+    size_type size() const noexcept {
+        auto const head = head_.load(::std::memory_order_acquire);
+        auto const tail = tail_.load(::std::memory_order_acquire);
+        return tail > head ? tail - head : 0u;
+    }
+
+    bool empty() const noexcept {
+        return size() == 0u;
+    }
+
+    size_type capacity() const noexcept {
+        return mask_ + 1u;
+    }
+
+private:
+    alignas(cache_line_size) ::std::atomic<size_type> head_{0u};
+    alignas(cache_line_size) ::std::atomic<size_type> tail_{0u};
+
+    alignas(cache_line_size) slot_type* slots_ = nullptr;
+    size_type                           mask_;
+    allocator_reference                 allocator_;
+};
+
+} // namespace flux::fou
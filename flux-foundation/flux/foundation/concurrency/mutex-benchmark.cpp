@@ -0,0 +1,96 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace flux::fou;
+
+namespace {
+
+// Threads that allocate and free nodes of a `memory_pool` they share, the critical sections are as
+// short as the ones every pool behind an `allocator_storage` has. They are started before and
+// joined after the measurement, which only covers rounds of `iterations` allocations per thread,
+// so that creating the threads is not part of the time.
+template <typename Mutex>
+class contenders {
+public:
+    static constexpr ::std::size_t iterations = 100000u;
+    static constexpr ::std::size_t node_size  = sizeof(::std::uintptr_t);
+
+    explicit contenders(::std::size_t thread_count)
+            : pool_{memory_pool<>{node_size, memory_pool<>::min_block_size(node_size, 256u)}} {
+        for (::std::size_t t = 0u; t < thread_count; ++t)
+            threads_.emplace_back([this] { run(); });
+    }
+
+    ~contenders() {
+        stop_.store(true, ::std::memory_order_relaxed);
+        generation_.fetch_add(1u, ::std::memory_order_release);
+        generation_.notify_all();
+        for (auto& thread : threads_)
+            thread.join();
+    }
+
+    contenders(contenders const&)            = delete;
+    contenders& operator=(contenders const&) = delete;
+
+    // Starts a round and waits until every thread has finished it.
+    void round() noexcept {
+        auto const finished = done_.load(::std::memory_order_relaxed) + threads_.size();
+        generation_.fetch_add(1u, ::std::memory_order_release);
+        generation_.notify_all();
+        auto done = done_.load(::std::memory_order_acquire);
+        while (done != finished) {
+            done_.wait(done, ::std::memory_order_acquire);
+            done = done_.load(::std::memory_order_acquire);
+        }
+    }
+
+private:
+    void run() noexcept {
+        for (::std::size_t generation = 0u;; ++generation) {
+            generation_.wait(generation, ::std::memory_order_acquire);
+            if (stop_.load(::std::memory_order_relaxed))
+                return;
+            for (::std::size_t i = 0u; i < iterations; ++i) {
+                auto* node = static_cast<::std::uintptr_t*>(pool_.allocate_node(node_size, 1u));
+                *node      = i;
+                pool_.deallocate_node(node, node_size, 1u);
+            }
+            done_.fetch_add(1u, ::std::memory_order_release);
+            done_.notify_one();
+        }
+    }
+
+    allocator_storage<direct_storage<memory_pool<>>, Mutex> pool_;
+    ::std::vector<::std::thread>                            threads_;
+    ::std::atomic<::std::size_t>                            generation_{0u};
+    ::std::atomic<::std::size_t>                            done_{0u};
+    ::std::atomic<bool>                                     stop_{false};
+};
+
+template <typename Mutex>
+void benchmark_contention(char const* name) {
+    for (::std::size_t thread_count : {1u, 2u, 4u, 8u, 16u, 32u}) {
+        BENCHMARK_ADVANCED(::std::string{name} + ", " + ::std::to_string(thread_count) +
+                           " threads")(Catch::Benchmark::Chronometer meter) {
+            contenders<Mutex> threads{thread_count};
+            meter.measure([&threads] { threads.round(); });
+        };
+    }
+}
+
+} // namespace
+
+TEST_CASE("fou::mutex contention", "[flux-concurrency/mutex.hpp]") {
+    benchmark_contention<::std::mutex>("std::mutex");
+    benchmark_contention<spin_mutex>("spin_mutex");
+    benchmark_contention<ticket_mutex>("ticket_mutex");
+    benchmark_contention<adaptive_mutex>("adaptive_mutex");
+}
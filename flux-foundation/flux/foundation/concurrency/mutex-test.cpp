@@ -0,0 +1,103 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace flux::fou;
+
+namespace {
+
+static_assert(lockable<spin_mutex>);
+static_assert(lockable<ticket_mutex>);
+static_assert(lockable<adaptive_mutex>);
+
+template <typename Mutex>
+void check_lock() {
+    Mutex mutex;
+    CHECK(mutex.try_lock());
+    CHECK_FALSE(mutex.try_lock());
+    mutex.unlock();
+
+    mutex.lock();
+    CHECK_FALSE(mutex.try_lock());
+    mutex.unlock();
+    CHECK(mutex.try_lock());
+    mutex.unlock();
+}
+
+// Allocates and frees nodes of a `memory_pool` shared by `thread_count` threads. The nodes are
+// written while they are owned, so a broken lock shows up as a corrupted node or counter.
+template <typename Mutex>
+void check_contention(::std::size_t thread_count) {
+    constexpr ::std::size_t iterations = 2000u;
+    constexpr ::std::size_t node_size  = sizeof(::std::uintptr_t);
+
+    allocator_storage<direct_storage<memory_pool<>>, Mutex> pool{
+            memory_pool<>{node_size, memory_pool<>::min_block_size(node_size, 256u)}};
+    Mutex                        mutex;
+    ::std::size_t                counter = 0u;
+    ::std::vector<::std::size_t> corrupted(thread_count);
+
+    ::std::vector<::std::thread> threads;
+    for (::std::size_t t = 0u; t < thread_count; ++t) {
+        threads.emplace_back([&, t] {
+            for (::std::size_t i = 0u; i < iterations; ++i) {
+                auto* node = static_cast<::std::uintptr_t*>(pool.allocate_node(node_size, 1u));
+                *node      = t;
+                {
+                    ::std::lock_guard<Mutex> guard{mutex};
+                    ++counter;
+                }
+                corrupted[t] += *node != t;
+                pool.deallocate_node(node, node_size, 1u);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    CHECK(counter == thread_count * iterations);
+    for (auto count : corrupted)
+        CHECK(count == 0u);
+}
+
+} // namespace
+
+TEST_CASE("fou::spin_mutex", "[flux-concurrency/mutex.hpp]") {
+    check_lock<spin_mutex>();
+    for (auto thread_count : {1u, 4u, 32u})
+        check_contention<spin_mutex>(thread_count);
+}
+
+TEST_CASE("fou::ticket_mutex", "[flux-concurrency/mutex.hpp]") {
+    check_lock<ticket_mutex>();
+    for (auto thread_count : {1u, 4u, 32u})
+        check_contention<ticket_mutex>(thread_count);
+}
+
+TEST_CASE("fou::adaptive_mutex", "[flux-concurrency/mutex.hpp]") {
+    check_lock<adaptive_mutex>();
+    for (auto thread_count : {1u, 4u, 32u})
+        check_contention<adaptive_mutex>(thread_count);
+
+    SECTION("sleeping waiter") {
+        adaptive_mutex mutex;
+        int            value = 0;
+        mutex.lock();
+        ::std::thread waiter{[&] {
+            mutex.lock();
+            ++value;
+            mutex.unlock();
+        }};
+        // Long enough for the waiter to stop spinning and sleep in the kernel.
+        ::std::this_thread::sleep_for(::std::chrono::milliseconds{10});
+        value = 1;
+        mutex.unlock();
+        waiter.join();
+        CHECK(value == 2);
+    }
+}
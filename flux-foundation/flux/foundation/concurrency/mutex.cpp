@@ -0,0 +1,54 @@
+#include <flux/foundation/concurrency/mutex.hpp>
+
+#if FLUX_TARGET(LINUX)
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+namespace flux::fou {
+
+namespace {
+
+// Sleeps as long as the `word` holds the `value`, it may return spuriously.
+void wait_on(::std::atomic<::std::uint32_t>& word, ::std::uint32_t value) noexcept {
+#if FLUX_TARGET(LINUX)
+    ::syscall(SYS_futex, reinterpret_cast<::std::uint32_t*>(&word), FUTEX_WAIT_PRIVATE, value,
+              nullptr, nullptr, 0);
+#else
+    word.wait(value, ::std::memory_order_relaxed);
+#endif
+}
+
+void wake_one(::std::atomic<::std::uint32_t>& word) noexcept {
+#if FLUX_TARGET(LINUX)
+    ::syscall(SYS_futex, reinterpret_cast<::std::uint32_t*>(&word), FUTEX_WAKE_PRIVATE, 1, nullptr,
+              nullptr, 0);
+#else
+    word.notify_one();
+#endif
+}
+
+} // namespace
+
+void adaptive_mutex::lock_contended() noexcept {
+    // Spins until `backoff` would yield, the owner is likely to be done by then.
+    for (backoff wait; !wait.is_yielding(); wait.pause()) {
+        auto expected = state_.load(::std::memory_order_relaxed);
+        if (expected == unlocked &&
+            state_.compare_exchange_weak(expected, locked, ::std::memory_order_acquire,
+                                         ::std::memory_order_relaxed))
+            return;
+    }
+
+    // From now on the lock is taken as `contended`, as there may be other sleeping threads that
+    // the next `unlock()` has to wake.
+    while (state_.exchange(contended, ::std::memory_order_acquire) != unlocked)
+        wait_on(state_, contended);
+}
+
+void adaptive_mutex::wake() noexcept {
+    wake_one(state_);
+}
+
+} // namespace flux::fou
@@ -0,0 +1,113 @@
+#pragma once
+#include <flux/foundation/concurrency/backoff.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace flux::fou {
+
+// A test-and-test-and-set lock for critical sections of a few instructions, e.g. around the free
+// list of a `memory_pool`. Waiting threads spin on a plain load, so that the cache line is shared
+// until the lock is released, and back off before they give up their time slice.
+// NOTE:
+//  It is not fair, a thread may take the lock again right after it has released it.
+class [[nodiscard]] spin_mutex {
+public:
+    spin_mutex() noexcept = default;
+
+    spin_mutex(spin_mutex const&)            = delete;
+    spin_mutex& operator=(spin_mutex const&) = delete;
+
+    void lock() noexcept {
+        for (backoff wait; locked_.exchange(true, ::std::memory_order_acquire);) {
+            while (locked_.load(::std::memory_order_relaxed))
+                wait.pause();
+        }
+    }
+
+    bool try_lock() noexcept {
+        return !locked_.load(::std::memory_order_relaxed) &&
+               !locked_.exchange(true, ::std::memory_order_acquire);
+    }
+
+    void unlock() noexcept {
+        locked_.store(false, ::std::memory_order_release);
+    }
+
+private:
+    ::std::atomic<bool> locked_{false};
+};
+
+// A spin lock that is taken in the order it has been requested, so no thread starves under
+// contention. Every waiter spins on the same counter though, so it is meant for a few threads.
+class [[nodiscard]] ticket_mutex {
+public:
+    ticket_mutex() noexcept = default;
+
+    ticket_mutex(ticket_mutex const&)            = delete;
+    ticket_mutex& operator=(ticket_mutex const&) = delete;
+
+    void lock() noexcept {
+        auto const ticket = next_.fetch_add(1u, ::std::memory_order_relaxed);
+        for (backoff wait; serving_.load(::std::memory_order_acquire) != ticket;)
+            wait.pause();
+    }
+
+    bool try_lock() noexcept {
+        auto ticket = serving_.load(::std::memory_order_relaxed);
+        return next_.compare_exchange_strong(ticket, ticket + 1u, ::std::memory_order_acquire,
+                                             ::std::memory_order_relaxed);
+    }
+
+    void unlock() noexcept {
+        // Only the owner writes `serving_`, so it doesn't need a read-modify-write.
+        serving_.store(serving_.load(::std::memory_order_relaxed) + 1u,
+                       ::std::memory_order_release);
+    }
+
+private:
+    ::std::atomic<::std::uint32_t> next_{0u};
+    ::std::atomic<::std::uint32_t> serving_{0u};
+};
+
+// A lock that spins for a short while and then sleeps in the kernel until it is released, on
+// Linux with a futex. Uncontended, locking and unlocking are a single atomic operation each, and
+// unlocking only makes a system call when there are sleeping threads.
+class [[nodiscard]] adaptive_mutex {
+public:
+    adaptive_mutex() noexcept = default;
+
+    adaptive_mutex(adaptive_mutex const&)            = delete;
+    adaptive_mutex& operator=(adaptive_mutex const&) = delete;
+
+    void lock() noexcept {
+        auto expected = unlocked;
+        if (!state_.compare_exchange_strong(expected, locked, ::std::memory_order_acquire,
+                                            ::std::memory_order_relaxed)) [[unlikely]]
+            lock_contended();
+    }
+
+    bool try_lock() noexcept {
+        auto expected = unlocked;
+        return state_.compare_exchange_strong(expected, locked, ::std::memory_order_acquire,
+                                              ::std::memory_order_relaxed);
+    }
+
+    void unlock() noexcept {
+        if (state_.exchange(unlocked, ::std::memory_order_release) == contended) [[unlikely]]
+            wake();
+    }
+
+private:
+    static constexpr ::std::uint32_t unlocked  = 0u;
+    static constexpr ::std::uint32_t locked    = 1u;
+    static constexpr ::std::uint32_t contended = 2u;
+
+    void lock_contended() noexcept;
+
+    void wake() noexcept;
+
+    ::std::atomic<::std::uint32_t> state_{unlocked};
+};
+
+} // namespace flux::fou
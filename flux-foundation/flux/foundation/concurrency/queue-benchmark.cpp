@@ -0,0 +1,131 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace flux::fou;
+
+namespace {
+
+constexpr ::std::size_t capacity = 1024u;
+constexpr ::std::size_t items    = 100000u;
+constexpr ::std::size_t trips    = 10000u;
+
+// The baseline the ring queues replace: a `std::deque` behind a `std::mutex`.
+template <typename T>
+class locked_queue {
+public:
+    explicit locked_queue(::std::size_t) noexcept {}
+
+    bool push(T value) noexcept {
+        ::std::lock_guard<::std::mutex> guard{mutex_};
+        queue_.push_back(value);
+        return true;
+    }
+
+    bool pop(T& value) noexcept {
+        ::std::lock_guard<::std::mutex> guard{mutex_};
+        if (queue_.empty())
+            return false;
+        value = queue_.front();
+        queue_.pop_front();
+        return true;
+    }
+
+private:
+    ::std::mutex    mutex_;
+    ::std::deque<T> queue_;
+};
+
+// Passes `items` integers from the producers to the consumers, each consumer pops its share.
+template <typename Queue>
+void pass_items(::std::size_t producers, ::std::size_t consumers) {
+    Queue                        queue{capacity};
+    ::std::vector<::std::thread> threads;
+    for (::std::size_t p = 0u; p < producers; ++p) {
+        threads.emplace_back([&queue, producers] {
+            for (::std::size_t i = 0u; i < items / producers; ++i) {
+                while (!queue.push(i))
+                    ::std::this_thread::yield();
+            }
+        });
+    }
+    for (::std::size_t c = 0u; c < consumers; ++c) {
+        threads.emplace_back([&queue, consumers] {
+            ::std::size_t value = 0u;
+            for (::std::size_t i = 0u; i < items / consumers; ++i) {
+                while (!queue.pop(value))
+                    ::std::this_thread::yield();
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+}
+
+// Bounces an integer `trips` times between two threads through a pair of queues, so that every
+// push waits for the previous pop and the time is dominated by the latency of a hand-off.
+template <typename Queue>
+void ping_pong() {
+    Queue         ping{capacity};
+    Queue         pong{capacity};
+    ::std::thread echo{[&] {
+        ::std::size_t value = 0u;
+        for (::std::size_t i = 0u; i < trips; ++i) {
+            while (!ping.pop(value))
+                ::std::this_thread::yield();
+            while (!pong.push(value))
+                ::std::this_thread::yield();
+        }
+    }};
+    ::std::size_t value = 0u;
+    for (::std::size_t i = 0u; i < trips; ++i) {
+        while (!ping.push(i))
+            ::std::this_thread::yield();
+        while (!pong.pop(value))
+            ::std::this_thread::yield();
+    }
+    echo.join();
+}
+
+} // namespace
+
+TEST_CASE("fou::spsc_queue throughput", "[flux-concurrency/spsc_queue.hpp]") {
+    BENCHMARK("spsc_queue") {
+        pass_items<spsc_queue<::std::size_t>>(1u, 1u);
+    };
+    BENCHMARK("std::mutex + std::deque") {
+        pass_items<locked_queue<::std::size_t>>(1u, 1u);
+    };
+}
+
+TEST_CASE("fou::spsc_queue latency", "[flux-concurrency/spsc_queue.hpp]") {
+    BENCHMARK("spsc_queue") {
+        ping_pong<spsc_queue<::std::size_t>>();
+    };
+    BENCHMARK("std::mutex + std::deque") {
+        ping_pong<locked_queue<::std::size_t>>();
+    };
+}
+
+TEST_CASE("fou::mpmc_queue throughput", "[flux-concurrency/mpmc_queue.hpp]") {
+    BENCHMARK("mpmc_queue, 4 producers, 4 consumers") {
+        pass_items<mpmc_queue<::std::size_t>>(4u, 4u);
+    };
+    BENCHMARK("std::mutex + std::deque, 4 producers, 4 consumers") {
+        pass_items<locked_queue<::std::size_t>>(4u, 4u);
+    };
+}
+
+TEST_CASE("fou::mpmc_queue latency", "[flux-concurrency/mpmc_queue.hpp]") {
+    BENCHMARK("mpmc_queue") {
+        ping_pong<mpmc_queue<::std::size_t>>();
+    };
+    BENCHMARK("std::mutex + std::deque") {
+        ping_pong<locked_queue<::std::size_t>>();
+    };
+}
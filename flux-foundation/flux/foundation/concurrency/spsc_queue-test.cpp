@@ -0,0 +1,89 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <thread>
+
+using namespace flux::fou;
+
+namespace {
+
+struct [[nodiscard]] move_only final {
+    explicit move_only(int v) noexcept : value{v} {}
+
+    move_only(move_only&&) noexcept            = default;
+    move_only& operator=(move_only&&) noexcept = default;
+
+    int value;
+};
+
+} // namespace
+
+TEST_CASE("fou::spsc_queue", "[flux-concurrency/spsc_queue.hpp]") {
+    spsc_queue<move_only> queue{3u};
+    CHECK(queue.capacity() == 4u);
+    CHECK(queue.empty());
+
+    move_only value{0};
+    CHECK_FALSE(queue.pop(value));
+
+    for (int i = 0; i < 4; ++i)
+        CHECK(queue.emplace(i));
+    CHECK_FALSE(queue.push(move_only{4}));
+    CHECK(queue.size() == 4u);
+
+    CHECK(queue.pop(value));
+    CHECK(value.value == 0);
+
+    SECTION("batch") {
+        move_only values[] = {move_only{4}, move_only{5}};
+        CHECK(queue.push(values, 2u) == 1u);
+
+        move_only popped[] = {move_only{0}, move_only{0}, move_only{0}, move_only{0},
+                              move_only{0}};
+        CHECK(queue.pop(popped, 5u) == 4u);
+        for (int i = 0; i < 4; ++i)
+            CHECK(popped[i].value == i + 1);
+        CHECK(queue.empty());
+    }
+    SECTION("stateful allocator") {
+        memory_stack<>          stack{4096u};
+        spsc_queue<int, memory_stack<>> other{16u, stack};
+        CHECK(other.push(1));
+        CHECK(stack.capacity() < 4096u);
+    }
+}
+
+TEST_CASE("fou::spsc_queue concurrent", "[flux-concurrency/spsc_queue.hpp]") {
+    constexpr int count = 100000;
+
+    spsc_queue<int> queue{64u};
+    ::std::thread   producer{[&] {
+        int batch[8];
+        for (int i = 0; i < count;) {
+            // Alternates between single and batch pushes.
+            if (i % 2 == 0) {
+                if (queue.push(i))
+                    ++i;
+            } else {
+                auto const n = ::std::min(8, count - i);
+                for (int j = 0; j < n; ++j)
+                    batch[j] = i + j;
+                i += static_cast<int>(queue.push(batch, static_cast<::std::size_t>(n)));
+            }
+        }
+    }};
+
+    int  expected = 0;
+    auto ordered  = true;
+    int  batch[16];
+    while (expected < count) {
+        auto const n = queue.pop(batch, 16u);
+        for (::std::size_t i = 0u; i < n; ++i)
+            ordered = ordered && batch[i] == expected++;
+    }
+    producer.join();
+
+    CHECK(ordered);
+    CHECK(queue.empty());
+}
@@ -0,0 +1,156 @@
+#pragma once
+#include <flux/foundation/memory/allocator_storage.hpp>
+#include <flux/foundation/memory/default_allocator.hpp>
+#include <flux/foundation/memory/uninitialized_storage.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace flux::fou {
+
+// A bounded lock-free ring buffer with a single producer and a single consumer thread. Each side
+// keeps a copy of the index of the other side and only reloads it when the queue looks full or
+// empty, so that in the steady state the cache line of the other side is rarely touched.
+// The capacity is rounded up to a power of two, the slots are allocated from the `RawAllocator`
+// and `T` is constructed in place, so it doesn't have to be default-constructible.
+// NOTE:
+//  `push()` must only be called by the producer, `pop()` by the consumer.
+template <meta::nothrow_move_constructible T, raw_allocator RawAllocator = default_allocator>
+    requires meta::nothrow_move_assignable<T>
+class [[nodiscard]] spsc_queue {
+    using allocator_reference = allocator_reference<RawAllocator>;
+    using slot_type           = uninitialized_storage<T>;
+
+public:
+    using value_type     = T;
+    using allocator_type = typename allocator_reference::allocator_type;
+    using size_type      = ::std::size_t;
+
+    explicit spsc_queue(size_type capacity) noexcept
+        requires(not is_stateful_allocator<allocator_type>::value)
+            : spsc_queue{capacity, allocator_type{}} {}
+
+    spsc_queue(size_type capacity, allocator_reference allocator) noexcept
+            : mask_{(size_type{1} << ilog2_ceil(capacity)) - 1u}, allocator_{allocator} {
+        FLUX_ASSERT(capacity > 0u);
+        slots_ = static_cast<slot_type*>(
+                allocator_.allocate_array(mask_ + 1u, sizeof(slot_type), alignof(slot_type)));
+    }
+
+    ~spsc_queue() {
+        auto const tail = tail_.load(::std::memory_order_relaxed);
+        for (auto head = head_.load(::std::memory_order_relaxed); head != tail; ++head)
+            ::std::destroy_at(slot(head));
+        allocator_.deallocate_array(slots_, mask_ + 1u, sizeof(slot_type), alignof(slot_type));
+    }
+
+    spsc_queue(spsc_queue const&)            = delete;
+    spsc_queue& operator=(spsc_queue const&) = delete;
+
+    // Constructs a value at the back, returns `false` if the queue is full.
+    template <typename... Args>
+        requires meta::nothrow_constructible<T, Args...>
+    bool emplace(Args&&... args) noexcept {
+        auto const tail = tail_.load(::std::memory_order_relaxed);
+        if (tail - head_cache_ > mask_) {
+            head_cache_ = head_.load(::std::memory_order_acquire);
+            if (tail - head_cache_ > mask_)
+                return false;
+        }
+
+        ::std::construct_at(slot(tail), ::std::forward<Args>(args)...);
+        tail_.store(tail + 1u, ::std::memory_order_release);
+        return true;
+    }
+
+    bool push(T const& value) noexcept
+        requires meta::nothrow_copy_constructible<T>
+    {
+        return emplace(value);
+    }
+
+    bool push(T&& value) noexcept {
+        return emplace(::std::move(value));
+    }
+
+    // Moves as many values of `[first, first + count)` as fit to the back, they are published to
+    // the consumer at once. Returns the number of values that were pushed.
+    size_type push(T* first, size_type count) noexcept {
+        auto const tail = tail_.load(::std::memory_order_relaxed);
+        if (mask_ + 1u - (tail - head_cache_) < count)
+            head_cache_ = head_.load(::std::memory_order_acquire);
+
+        auto const n = ::std::min(count, mask_ + 1u - (tail - head_cache_));
+        for (size_type i = 0u; i < n; ++i)
+            ::std::construct_at(slot(tail + i), ::std::move(first[i]));
+        tail_.store(tail + n, ::std::memory_order_release);
+        return n;
+    }
+
+    // Moves the front value into `value`, returns `false` if the queue is empty.
+    bool pop(T& value) noexcept {
+        auto const head = head_.load(::std::memory_order_relaxed);
+        if (head == tail_cache_) {
+            tail_cache_ = tail_.load(::std::memory_order_acquire);
+            if (head == tail_cache_)
+                return false;
+        }
+
+        auto* front = slot(head);
+        value       = ::std::move(*front);
+        ::std::destroy_at(front);
+        head_.store(head + 1u, ::std::memory_order_release);
+        return true;
+    }
+
+    // Moves up to `count` values from the front to `[first, first + count)`, they are released
+    // to the producer at once. Returns the number of values that were popped.
+    size_type pop(T* first, size_type count) noexcept {
+        auto const head = head_.load(::std::memory_order_relaxed);
+        if (tail_cache_ - head < count)
+            tail_cache_ = tail_.load(::std::memory_order_acquire);
+
+        auto const n = ::std::min(count, tail_cache_ - head);
+        for (size_type i = 0u; i < n; ++i) {
+            auto* front = slot(head + i);
+            first[i]    = ::std::move(*front);
+            ::std::destroy_at(front);
+        }
+        head_.store(head + n, ::std::memory_order_release);
+        return n;
+    }
+
+    // Returns the number of values, it is only a snapshot if the other side is active.
+    size_type size() const noexcept {
+        // The head is loaded first, it can only have moved towards the tail since.
+        auto const head = head_.load(::std::memory_order_acquire);
+        return tail_.load(::std::memory_order_acquire) - head;
+    }
+
+    bool empty() const noexcept {
+        return size() == 0u;
+    }
+
+    size_type capacity() const noexcept {
+        return mask_ + 1u;
+    }
+
+private:
+    T* slot(size_type index) const noexcept {
+        return slots_[index & mask_].data();
+    }
+
+    // The indices only grow, they wrap around through the `mask_`.
+    alignas(cache_line_size) ::std::atomic<size_type> head_{0u};
+    size_type tail_cache_ = 0u;
+
+    alignas(cache_line_size) ::std::atomic<size_type> tail_{0u};
+    size_type head_cache_ = 0u;
+
+    alignas(cache_line_size) slot_type* slots_ = nullptr;
+    size_type                           mask_;
+    allocator_reference                 allocator_;
+};
+
+} // namespace flux::fou
@@ -0,0 +1,112 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+
+using namespace flux::fou;
+
+namespace {
+
+enum resource : task_graph::resource_id { input, positions, velocities, output };
+
+struct [[nodiscard]] trace final {
+    // Records the order in which the tasks finished, from any thread.
+    void operator()(int task) noexcept {
+        order[next.fetch_add(1)] = task;
+    }
+
+    int position(int task) const noexcept {
+        for (int i = 0; i < next.load(); ++i) {
+            if (order[i] == task)
+                return i;
+        }
+        return -1;
+    }
+
+    int                order[8] = {};
+    ::std::atomic<int> next{0};
+};
+
+} // namespace
+
+TEST_CASE("fou::task_graph", "[flux-concurrency/task_graph.hpp]") {
+    trace      finished;
+    task_graph graph;
+
+    auto const task = [&](int id) {
+        return [&finished, id] { finished(id); };
+    };
+
+    // 0 -> {1, 2} -> 3 -> 4, and 5 is independent.
+    CHECK(graph.add(task(0), {}, {input}) == 0u);
+    CHECK(graph.add(task(1), {input}, {positions}) == 1u);
+    CHECK(graph.add(task(2), {input}, {velocities}) == 2u);
+    CHECK(graph.add(task(3), {positions, velocities}, {output}) == 3u);
+    // Writes the input after it has been read, and reads the output.
+    CHECK(graph.add(task(4), {output}, {input}) == 4u);
+    CHECK(graph.add(task(5)) == 5u);
+    CHECK_FALSE(graph.is_compiled());
+
+    graph.compile();
+    CHECK(graph.is_compiled());
+    CHECK(graph.size() == 6u);
+    CHECK(graph.root_count() == 2u);
+    // 0->1, 0->2, 1->3, 2->3, 3->4, and the write of 4 after the reads of 1 and 2 and the write of 0.
+    CHECK(graph.edge_count() == 8u);
+
+    SECTION("serial") {
+        graph.run();
+        for (int i = 0; i < 6; ++i)
+            CHECK(finished.position(i) == i);
+    }
+    SECTION("parallel") {
+        job_system_config config;
+        config.worker_count = 4u;
+        job_system jobs{config};
+
+        for (int frame = 0; frame < 100; ++frame) {
+            finished.next = 0;
+            graph.run(jobs);
+            REQUIRE(finished.next.load() == 6);
+            CHECK(finished.position(0) < finished.position(1));
+            CHECK(finished.position(0) < finished.position(2));
+            CHECK(finished.position(1) < finished.position(3));
+            CHECK(finished.position(2) < finished.position(3));
+            CHECK(finished.position(3) < finished.position(4));
+        }
+    }
+    SECTION("recompile") {
+        graph.add(task(6), {positions});
+        CHECK_FALSE(graph.is_compiled());
+        graph.compile();
+        CHECK(graph.edge_count() == 9u);
+
+        graph.clear();
+        CHECK(graph.size() == 0u);
+        graph.compile();
+        graph.run();
+        CHECK(finished.next.load() == 0);
+    }
+}
+
+TEST_CASE("fou::task_graph chain", "[flux-concurrency/task_graph.hpp]") {
+    job_system_config config;
+    config.worker_count = 2u;
+    job_system jobs{config};
+
+    // A long chain runs as one job, the tasks run in order without any synchronization.
+    int        value = 0;
+    task_graph graph;
+    for (int i = 0; i < 1000; ++i)
+        graph.add([&value, i] { value = value == i ? i + 1 : -1; }, {0u}, {0u});
+    graph.compile();
+    CHECK(graph.root_count() == 1u);
+    CHECK(graph.edge_count() == 999u);
+
+    for (int run = 0; run < 3; ++run) {
+        value = 0;
+        graph.run(jobs);
+        CHECK(value == 1000);
+    }
+}
@@ -0,0 +1,230 @@
+#include <flux/foundation/concurrency/task_graph.hpp>
+
+#include <limits>
+#include <memory>
+
+namespace flux::fou {
+
+namespace {
+
+using pending_count = ::std::atomic<::std::uint32_t>;
+
+constexpr ::std::size_t nodes_per_block    = 64u;
+constexpr ::std::size_t accesses_per_block = 256u;
+constexpr ::std::size_t initial_stack_size = 256u;
+
+// The bytes a `memory_stack` needs for an array, including the alignment and the debug fences.
+constexpr ::std::size_t stack_size(::std::size_t size, ::std::size_t alignment) noexcept {
+    return size + alignment - 1u + 2u * detail::debug_fence_size;
+}
+
+// Replaces the `stack` by one whose first block fits `size` bytes, so it never grows.
+void rebuild(memory_stack<>& stack, ::std::size_t size) noexcept {
+    ::std::destroy_at(&stack);
+    ::std::construct_at(&stack, memory_stack<>::min_block_size(size));
+}
+
+bool conflicts(detail::task_node const& node, detail::task_access const& access,
+               bool& is_write) noexcept {
+    auto found = false;
+    for (auto* other = node.accesses; other; other = other->next) {
+        if (other->resource == access.resource) {
+            found    = true;
+            is_write = is_write || other->is_write;
+        }
+    }
+    return found;
+}
+
+// Calls `edge(from, to)` for every task the task at `index` depends on, each of them once.
+// `marks` must be zero-initialized before the first call and is updated by every call.
+template <typename Edge>
+void for_each_dependency(detail::task_node* const* order, ::std::uint32_t index,
+                         ::std::uint32_t* marks, Edge&& edge) noexcept {
+    auto& node = *order[index];
+    for (auto* access = node.accesses; access; access = access->next) {
+        // Walks back to the last writer: a read depends on it, a write also on the readers since.
+        for (auto j = index; j-- > 0u;) {
+            auto is_write = false;
+            if (!conflicts(*order[j], *access, is_write))
+                continue;
+            if ((is_write || access->is_write) && marks[j] != index + 1u) {
+                marks[j] = index + 1u;
+                edge(*order[j], node);
+            }
+            if (is_write)
+                break;
+        }
+    }
+}
+
+} // namespace
+
+struct [[nodiscard]] task_graph::run_state final {
+    job_system*    jobs;
+    pending_count* pending;
+    job_counter*   counter;
+};
+
+task_graph::task_graph() noexcept
+        : nodes_{sizeof(detail::task_node),
+                 decltype(nodes_)::min_block_size(sizeof(detail::task_node), nodes_per_block)},
+          accesses_{sizeof(detail::task_access),
+                    decltype(accesses_)::min_block_size(sizeof(detail::task_access),
+                                                        accesses_per_block)},
+          schedule_{memory_stack<>::min_block_size(initial_stack_size)},
+          state_{memory_stack<>::min_block_size(initial_stack_size)} {}
+
+task_graph::~task_graph() {
+    clear();
+}
+
+void task_graph::clear() noexcept {
+    for (auto* node = first_; node;) {
+        for (auto* access = node->accesses; access;) {
+            auto* next = access->next;
+            accesses_.deallocate_node(access);
+            access = next;
+        }
+
+        auto* next = node->next;
+        node->destroy(*node);
+        nodes_.deallocate_node(node);
+        node = next;
+    }
+
+    first_       = nullptr;
+    last_        = nullptr;
+    roots_       = nullptr;
+    size_        = 0u;
+    root_count_  = 0u;
+    edge_count_  = 0u;
+    is_compiled_ = false;
+}
+
+detail::task_node& task_graph::create_node() noexcept {
+    FLUX_ASSERT(size_ < ::std::numeric_limits<task_id>::max());
+
+    auto* node = ::new (nodes_.allocate_node()) detail::task_node{};
+    node->index = static_cast<task_id>(size_++);
+    if (last_)
+        last_->next = node;
+    else
+        first_ = node;
+    last_        = node;
+    is_compiled_ = false;
+    return *node;
+}
+
+void task_graph::add_access(detail::task_node& node, resource_id resource, bool is_write) noexcept {
+    node.accesses = ::new (accesses_.allocate_node()) detail::task_access{node.accesses, resource,
+                                                                          is_write};
+}
+
+void task_graph::compile() noexcept {
+    // The scratch memory of the compilation comes from the per-run stack, which is big enough for
+    // the pending counts of the tasks afterwards.
+    auto const order_size = size_ * sizeof(detail::task_node*);
+    auto const marks_size = size_ * sizeof(::std::uint32_t);
+    rebuild(state_, stack_size(order_size, alignof(detail::task_node*)) +
+                    stack_size(marks_size, alignof(::std::uint32_t)));
+
+    memory_stack_unwinder scratch{state_};
+    auto* order = static_cast<detail::task_node**>(
+            state_.allocate(order_size, alignof(detail::task_node*)));
+    auto* marks = static_cast<::std::uint32_t*>(
+            state_.allocate(marks_size, alignof(::std::uint32_t)));
+    {
+        auto i = 0u;
+        for (auto* node = first_; node; node = node->next) {
+            node->successor_count   = 0u;
+            node->predecessor_count = 0u;
+            order[i]                = node;
+            marks[i++]              = 0u;
+        }
+    }
+
+    // Counts the dependencies first, so that the schedule can be allocated in one go.
+    edge_count_ = 0u;
+    root_count_ = 0u;
+    for (auto i = 0u; i < size_; ++i) {
+        for_each_dependency(order, i, marks, [&](detail::task_node& from, detail::task_node& to) {
+            ++from.successor_count;
+            ++to.predecessor_count;
+            ++edge_count_;
+        });
+        root_count_ += order[i]->predecessor_count == 0u;
+    }
+
+    rebuild(schedule_, stack_size((edge_count_ + root_count_) * sizeof(detail::task_node*),
+                                  alignof(detail::task_node*)));
+    auto* successors = static_cast<detail::task_node**>(
+            schedule_.allocate((edge_count_ + root_count_) * sizeof(detail::task_node*),
+                               alignof(detail::task_node*)));
+    roots_ = successors + edge_count_;
+
+    auto* root = roots_;
+    for (auto i = 0u; i < size_; ++i) {
+        auto& node      = *order[i];
+        node.successors = successors;
+        successors += node.successor_count;
+        node.successor_count = 0u;
+        marks[i]             = 0u;
+        if (node.predecessor_count == 0u)
+            *root++ = &node;
+    }
+    for (auto i = 0u; i < size_; ++i) {
+        for_each_dependency(order, i, marks, [](detail::task_node& from, detail::task_node& to) {
+            from.successors[from.successor_count++] = &to;
+        });
+    }
+
+    is_compiled_ = true;
+}
+
+void task_graph::run(job_system& jobs) noexcept {
+    FLUX_ASSERT(is_compiled());
+    if (size_ == 0u)
+        return;
+
+    memory_stack_unwinder unwinder{state_};
+    auto* pending = static_cast<pending_count*>(
+            state_.allocate(size_ * sizeof(pending_count), alignof(pending_count)));
+    for (auto* node = first_; node; node = node->next)
+        ::std::construct_at(pending + node->index, node->predecessor_count);
+
+    job_counter counter;
+    run_state   state{&jobs, pending, &counter};
+    for (size_type i = 0u; i < root_count_; ++i)
+        start(state, *roots_[i]);
+    jobs.wait(counter);
+}
+
+void task_graph::run() noexcept {
+    for (auto* node = first_; node; node = node->next)
+        node->invoke(*node);
+}
+
+void task_graph::start(run_state& state, detail::task_node& node) noexcept {
+    state.jobs->run([this, &state, &node] { execute(state, node); }, *state.counter);
+}
+
+void task_graph::execute(run_state& state, detail::task_node& node) noexcept {
+    // The last ready successor runs in this job, which saves a job for chains of tasks.
+    for (auto* current = &node; current;) {
+        current->invoke(*current);
+
+        detail::task_node* next = nullptr;
+        for (auto i = 0u; i < current->successor_count; ++i) {
+            auto& successor = *current->successors[i];
+            if (state.pending[successor.index].fetch_sub(1u, ::std::memory_order_acq_rel) != 1u)
+                continue;
+            if (next)
+                start(state, *next);
+            next = &successor;
+        }
+        current = next;
+    }
+}
+
+} // namespace flux::fou
@@ -0,0 +1,147 @@
+#pragma once
+#include <flux/foundation/concurrency/job_system.hpp>
+#include <flux/foundation/memory/memory_pool.hpp>
+#include <flux/foundation/memory/memory_stack.hpp>
+
+#include <initializer_list>
+
+namespace flux::fou {
+
+class [[nodiscard]] task_graph;
+
+namespace detail {
+
+struct [[nodiscard]] task_access final {
+    task_access*     next;
+    ::std::uintptr_t resource;
+    bool             is_write;
+};
+
+struct [[nodiscard]] task_node final {
+    static constexpr ::std::size_t storage_size = 64u;
+
+    using invoke_function  = void (*)(task_node& self) noexcept;
+    using destroy_function = void (*)(task_node& self) noexcept;
+
+    invoke_function  invoke;
+    destroy_function destroy;
+    task_node*       next;
+    task_access*     accesses;
+    // Filled in by `task_graph::compile()`.
+    task_node**      successors;
+    ::std::uint32_t  successor_count;
+    ::std::uint32_t  predecessor_count;
+    ::std::uint32_t  index;
+
+    alignas(16) ::std::byte storage[storage_size];
+};
+
+} // namespace detail
+
+// A set of tasks with read and write dependencies on resources, which is compiled once into a
+// schedule and can then be run any number of times, e.g. every frame.
+// The declaration order defines the dependencies, like the order of commands in a command buffer:
+// a task runs after the last task declared before it that writes one of its resources, and a task
+// writing a resource also runs after the tasks that read the resource since it was last written.
+// The graph is thus acyclic by construction and the declaration order is a valid serial order.
+// The tasks and their accesses are allocated from `memory_pool`s, the schedule and the per-run
+// state from `memory_stack`s sized by `compile()`, so running the graph doesn't allocate anything
+// beyond what the `job_system` does.
+// NOTE:
+//  A resource is any integer identifying something the tasks share, e.g. an enum value or the
+//  address of a buffer. Tasks must not be added while the graph is running.
+class [[nodiscard]] task_graph {
+public:
+    using size_type   = ::std::size_t;
+    using resource_id = ::std::uintptr_t;
+    using task_id     = ::std::uint32_t;
+
+    static constexpr size_type max_task_size = detail::task_node::storage_size;
+
+    task_graph() noexcept;
+
+    ~task_graph();
+
+    task_graph(task_graph const&)            = delete;
+    task_graph& operator=(task_graph const&) = delete;
+
+    // Declares a task that calls `function()` after the tasks it depends on through the given
+    // resources. The graph has to be compiled again before it is run.
+    template <typename Function>
+    task_id add(Function&& function, ::std::initializer_list<resource_id> reads = {},
+                ::std::initializer_list<resource_id> writes = {}) noexcept {
+        using callable = meta::decay_t<Function>;
+        static_assert(sizeof(callable) <= max_task_size && alignof(callable) <= 16u,
+                      "The callable doesn't fit into a task, capture its state by reference.");
+
+        auto& node = create_node();
+        ::new (static_cast<void*>(node.storage)) callable(::std::forward<Function>(function));
+        node.invoke = [](detail::task_node& self) noexcept {
+            (*launder(reinterpret_cast<callable*>(self.storage)))();
+        };
+        node.destroy = [](detail::task_node& self) noexcept {
+            launder(reinterpret_cast<callable*>(self.storage))->~callable();
+        };
+        for (auto resource : reads)
+            add_access(node, resource, false);
+        for (auto resource : writes)
+            add_access(node, resource, true);
+        return node.index;
+    }
+
+    // Resolves the dependencies and sizes the storage for running the graph.
+    void compile() noexcept;
+
+    // Runs the graph on the `jobs` and returns once every task has finished. It must be called by
+    // a worker of the `jobs`, it helps to run the tasks while it waits.
+    void run(job_system& jobs) noexcept;
+
+    // Runs every task on the calling thread in declaration order.
+    void run() noexcept;
+
+    // Destroys all tasks.
+    void clear() noexcept;
+
+    bool is_compiled() const noexcept {
+        return is_compiled_;
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    // Returns the number of tasks without dependencies, it is valid after `compile()`.
+    size_type root_count() const noexcept {
+        return root_count_;
+    }
+
+    // Returns the number of dependencies, it is valid after `compile()`.
+    size_type edge_count() const noexcept {
+        return edge_count_;
+    }
+
+private:
+    struct [[nodiscard]] run_state;
+
+    detail::task_node& create_node() noexcept;
+
+    void add_access(detail::task_node& node, resource_id resource, bool is_write) noexcept;
+
+    void start(run_state& state, detail::task_node& node) noexcept;
+
+    void execute(run_state& state, detail::task_node& node) noexcept;
+
+    memory_pool<node_pool> nodes_;
+    memory_pool<node_pool> accesses_;
+    memory_stack<>         schedule_;
+    memory_stack<>         state_;
+    detail::task_node*     first_       = nullptr;
+    detail::task_node*     last_        = nullptr;
+    detail::task_node**    roots_       = nullptr;
+    size_type              size_        = 0u;
+    size_type              root_count_  = 0u;
+    size_type              edge_count_  = 0u;
+    bool                   is_compiled_ = false;
+};
+
+} // namespace flux::fou
@@ -0,0 +1,81 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace flux::fou;
+
+TEST_CASE("fou::work_stealing_deque", "[flux-concurrency/work_stealing_deque.hpp]") {
+    work_stealing_deque<int, 4u> deque;
+    int                          value = 0;
+    CHECK(deque.empty());
+    CHECK_FALSE(deque.pop(value));
+    CHECK_FALSE(deque.steal(value));
+
+    for (int i = 0; i < 4; ++i)
+        CHECK(deque.push(i));
+    CHECK_FALSE(deque.push(4));
+    CHECK(deque.size() == 4u);
+
+    // The owner takes the newest value, thieves the oldest.
+    CHECK(deque.pop(value));
+    CHECK(value == 3);
+    CHECK(deque.steal(value));
+    CHECK(value == 0);
+    CHECK(deque.size() == 2u);
+
+    // The ring wraps around.
+    CHECK(deque.push(5));
+    CHECK(deque.push(6));
+    CHECK_FALSE(deque.push(7));
+    for (int expected : {6, 5, 2, 1}) {
+        CHECK(deque.pop(value));
+        CHECK(value == expected);
+    }
+    CHECK(deque.empty());
+}
+
+TEST_CASE("fou::work_stealing_deque concurrent", "[flux-concurrency/work_stealing_deque.hpp]") {
+    constexpr int count = 100000;
+
+    work_stealing_deque<int, 256u> deque;
+    ::std::vector<::std::atomic<int>> taken(count);
+    ::std::atomic<int>                remaining{count};
+
+    auto const take = [&](int value) {
+        taken[static_cast<::std::size_t>(value)].fetch_add(1, ::std::memory_order_relaxed);
+        remaining.fetch_sub(1, ::std::memory_order_relaxed);
+    };
+
+    ::std::vector<::std::thread> thieves;
+    for (int i = 0; i < 3; ++i) {
+        thieves.emplace_back([&] {
+            int value = 0;
+            while (remaining.load(::std::memory_order_relaxed) > 0) {
+                if (deque.steal(value))
+                    take(value);
+            }
+        });
+    }
+
+    int value = 0;
+    for (int i = 0; i < count;) {
+        if (deque.push(i))
+            ++i;
+        else if (deque.pop(value))
+            take(value);
+    }
+    while (deque.pop(value))
+        take(value);
+    for (auto& thief : thieves)
+        thief.join();
+
+    auto duplicates = 0;
+    for (auto& t : taken)
+        duplicates += t.load() != 1;
+    CHECK(duplicates == 0);
+    CHECK(remaining.load() == 0);
+}
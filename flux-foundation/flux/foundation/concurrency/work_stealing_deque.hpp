@@ -0,0 +1,107 @@
+#pragma once
+#include <flux/foundation/memory/align.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace flux::fou {
+
+// A fixed-capacity Chase-Lev deque. The owning thread pushes and pops at the bottom, like a stack,
+// while any other thread may steal from the top. The implementation follows "Correct and Efficient
+// Work-Stealing for Weak Memory Models" by Lê et al., but never grows, so that no buffer has to be
+// reclaimed while a thief may still read it.
+// NOTE:
+//  `push()` and `pop()` must only be called by the owner, `steal()` by any thread.
+template <meta::trivially_copyable T, ::std::size_t Capacity>
+struct [[nodiscard]] work_stealing_deque final {
+    static_assert(Capacity > 0u && (Capacity & (Capacity - 1u)) == 0u,
+                  "Capacity must be a power of two.");
+
+    using value_type = T;
+    using size_type  = ::std::size_t;
+
+    work_stealing_deque() noexcept = default;
+
+    work_stealing_deque(work_stealing_deque const&)            = delete;
+    work_stealing_deque& operator=(work_stealing_deque const&) = delete;
+
+    // Returns `false` if the deque is full.
+    bool push(T value) noexcept {
+        auto const b = bottom_.load(::std::memory_order_relaxed);
+        auto const t = top_.load(::std::memory_order_acquire);
+        if (b - t >= static_cast<index_type>(Capacity))
+            return false;
+
+        slot(b).store(value, ::std::memory_order_relaxed);
+        // A release store instead of the release fence of the paper, it is the same on x86 and
+        // sanitizers understand it.
+        bottom_.store(b + 1, ::std::memory_order_release);
+        return true;
+    }
+
+    // Takes the most recently pushed value, returns `false` if the deque is empty.
+    bool pop(T& value) noexcept {
+        auto const b = bottom_.load(::std::memory_order_relaxed) - 1;
+        bottom_.store(b, ::std::memory_order_relaxed);
+        ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+        auto t = top_.load(::std::memory_order_relaxed);
+
+        if (t > b) {
+            bottom_.store(b + 1, ::std::memory_order_relaxed);
+            return false;
+        }
+
+        value = slot(b).load(::std::memory_order_relaxed);
+        if (t != b)
+            return true;
+
+        // The last value, race against the thieves for it.
+        auto const won = top_.compare_exchange_strong(t, t + 1, ::std::memory_order_seq_cst,
+                                                      ::std::memory_order_relaxed);
+        bottom_.store(b + 1, ::std::memory_order_relaxed);
+        return won;
+    }
+
+    // Takes the least recently pushed value, returns `false` if the deque is empty or another
+    // thread won the race for the value.
+    bool steal(T& value) noexcept {
+        auto t = top_.load(::std::memory_order_acquire);
+        ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+        auto const b = bottom_.load(::std::memory_order_acquire);
+        if (t >= b)
+            return false;
+
+        value = slot(t).load(::std::memory_order_relaxed);
+        return top_.compare_exchange_strong(t, t + 1, ::std::memory_order_seq_cst,
+                                            ::std::memory_order_relaxed);
+    }
+
+    // Returns the number of values, it is only a snapshot if other threads access the deque.
+    size_type size() const noexcept {
+        auto const b = bottom_.load(::std::memory_order_relaxed);
+        auto const t = top_.load(::std::memory_order_relaxed);
+        return b > t ? static_cast<size_type>(b - t) : 0u;
+    }
+
+    bool empty() const noexcept {
+        return size() == 0u;
+    }
+
+    static constexpr size_type capacity() noexcept {
+        return Capacity;
+    }
+
+private:
+    using index_type = ::std::int64_t;
+
+    ::std::atomic<T>& slot(index_type index) noexcept {
+        return buffer_[static_cast<size_type>(index) & (Capacity - 1u)];
+    }
+
+    alignas(cache_line_size) ::std::atomic<index_type> top_{0};
+    alignas(cache_line_size) ::std::atomic<index_type> bottom_{0};
+    alignas(cache_line_size) ::std::atomic<T> buffer_[Capacity];
+};
+
+} // namespace flux::fou
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <flux/foundation/containers/dynamic_array.hpp>
+#include <flux/foundation/containers/flat_hash_map.hpp>
+#include <flux/foundation/containers/flat_hash_set.hpp>
+#include <flux/foundation/containers/inplace_vector.hpp>
+#include <flux/foundation/containers/intrusive_forward_list.hpp>
+#include <flux/foundation/containers/intrusive_list.hpp>
+#include <flux/foundation/containers/intrusive_tree.hpp>
+#include <flux/foundation/containers/slot_map.hpp>
+#include <flux/foundation/containers/small_vector.hpp>
+#include <flux/foundation/containers/soa_vector.hpp>
+#include <flux/foundation/containers/string_interner.hpp>
@@ -0,0 +1,33 @@
+#pragma once
+#include <flux/foundation/memory/uninitialized_algorithms.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace flux::fou::detail {
+
+// Relocates the values of `[first, last)` up by `count`, which leaves `count` uninitialized values
+// at `first`. It is a single `memmove` for trivially relocatable `T`.
+template <typename T>
+void open_gap(T* first, T* last, ::std::size_t count) noexcept {
+    if constexpr (meta::trivially_relocatable<T>) {
+        constexpr_relocate(first + count, first, static_cast<::std::size_t>(last - first));
+    } else {
+        // Moving up, the last value goes first.
+        while (last != first) {
+            --last;
+            relocate_at(last, last + count);
+        }
+    }
+}
+
+// Destroys the `count` values at `first` and relocates the values that follow them up to `last`
+// down into the gap.
+template <typename T>
+void close_gap(T* first, T* last, ::std::size_t count) noexcept {
+    ::std::destroy(first, first + count);
+    // Moving down never overwrites values that have not been relocated yet.
+    ranges::uninitialized_relocate(first + count, last, first);
+}
+
+} // namespace flux::fou::detail
@@ -0,0 +1,232 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#    include <emmintrin.h>
+#    define FLUX_HASH_GROUP_SSE2 (1)
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#    include <arm_neon.h>
+#    define FLUX_HASH_GROUP_NEON (1)
+#endif
+
+namespace flux::fou::detail {
+
+// Every slot of a hash table has a control byte: the 7 low bits of the hash of its key if it is
+// full, or one of the negative markers below. The markers are chosen so that a whole group can be
+// classified with a few vector instructions.
+using ctrl_t = ::std::int8_t;
+
+inline constexpr ctrl_t ctrl_empty    = -128; // 0b1000'0000
+inline constexpr ctrl_t ctrl_deleted  = -2;   // 0b1111'1110
+inline constexpr ctrl_t ctrl_sentinel = -1;   // 0b1111'1111, follows the last slot
+
+constexpr bool is_full(ctrl_t ctrl) noexcept {
+    return ctrl >= 0;
+}
+
+constexpr bool is_empty_or_deleted(ctrl_t ctrl) noexcept {
+    return ctrl < ctrl_sentinel;
+}
+
+// Scrambles the hash, so that hashes that only differ in a few bits, like the identity hashes of
+// integers and pointers, spread over both the groups and the 7 bits of the control byte.
+constexpr ::std::uint64_t mix_hash(::std::uint64_t hash) noexcept {
+#if defined(__SIZEOF_INT128__)
+    auto const product = static_cast<unsigned __int128>(hash) * 0x9E37'79B9'7F4A'7C15u;
+    return static_cast<::std::uint64_t>(product) ^ static_cast<::std::uint64_t>(product >> 64u);
+#else
+    hash ^= hash >> 33u;
+    hash *= 0xFF51'AFD7'ED55'8CCDu;
+    return hash ^ (hash >> 33u);
+#endif
+}
+
+// Selects the group where probing starts.
+constexpr ::std::size_t h1(::std::uint64_t hash) noexcept {
+    return static_cast<::std::size_t>(hash >> 7u);
+}
+
+// The part of the hash that is kept in the control byte.
+constexpr ctrl_t h2(::std::uint64_t hash) noexcept {
+    return static_cast<ctrl_t>(hash & 0x7Fu);
+}
+
+// The slots of a group that matched, either one bit per slot (`Shift` is 0) or the high bit of one
+// byte per slot (`Shift` is 3). Iterating yields the indices of the slots in ascending order.
+template <typename T, unsigned Shift>
+class [[nodiscard]] hash_group_mask {
+public:
+    constexpr explicit hash_group_mask(T mask) noexcept : mask_{mask} {}
+
+    constexpr explicit operator bool() const noexcept {
+        return mask_ != 0u;
+    }
+
+    constexpr ::std::size_t lowest() const noexcept {
+        return static_cast<::std::size_t>(::std::countr_zero(mask_)) >> Shift;
+    }
+
+    constexpr ::std::size_t operator*() const noexcept {
+        return lowest();
+    }
+
+    constexpr hash_group_mask& operator++() noexcept {
+        mask_ = static_cast<T>(mask_ & (mask_ - 1u));
+        return *this;
+    }
+
+    constexpr hash_group_mask begin() const noexcept {
+        return *this;
+    }
+
+    constexpr hash_group_mask end() const noexcept {
+        return hash_group_mask{0u};
+    }
+
+    constexpr bool operator==(hash_group_mask const&) const noexcept = default;
+
+private:
+    T mask_;
+};
+
+#if defined(FLUX_HASH_GROUP_SSE2)
+
+// The control bytes of 16 slots, matched with SSE2.
+class [[nodiscard]] hash_group {
+public:
+    using mask_type = hash_group_mask<::std::uint16_t, 0u>;
+
+    static constexpr ::std::size_t width = 16u;
+
+    explicit hash_group(ctrl_t const* ctrl) noexcept
+            : ctrl_{_mm_loadu_si128(reinterpret_cast<__m128i const*>(ctrl))} {}
+
+    mask_type match(ctrl_t hash) const noexcept {
+        return mask(_mm_cmpeq_epi8(_mm_set1_epi8(hash), ctrl_));
+    }
+
+    mask_type match_empty() const noexcept {
+        return match(ctrl_empty);
+    }
+
+    mask_type match_empty_or_deleted() const noexcept {
+        return mask(_mm_cmpgt_epi8(_mm_set1_epi8(ctrl_sentinel), ctrl_));
+    }
+
+    mask_type match_full() const noexcept {
+        return mask_type{static_cast<::std::uint16_t>(~_mm_movemask_epi8(ctrl_))};
+    }
+
+private:
+    static mask_type mask(__m128i bytes) noexcept {
+        return mask_type{static_cast<::std::uint16_t>(_mm_movemask_epi8(bytes))};
+    }
+
+    __m128i ctrl_;
+};
+
+#elif defined(FLUX_HASH_GROUP_NEON)
+
+// The control bytes of 8 slots, matched with NEON. A match sets all bits of a byte, only the high
+// one is kept.
+class [[nodiscard]] hash_group {
+public:
+    using mask_type = hash_group_mask<::std::uint64_t, 3u>;
+
+    static constexpr ::std::size_t width = 8u;
+
+    explicit hash_group(ctrl_t const* ctrl) noexcept : ctrl_{vld1_s8(ctrl)} {}
+
+    mask_type match(ctrl_t hash) const noexcept {
+        return mask(vceq_s8(ctrl_, vdup_n_s8(hash)));
+    }
+
+    mask_type match_empty() const noexcept {
+        return match(ctrl_empty);
+    }
+
+    mask_type match_empty_or_deleted() const noexcept {
+        return mask(vclt_s8(ctrl_, vdup_n_s8(ctrl_sentinel)));
+    }
+
+    mask_type match_full() const noexcept {
+        return mask(vcge_s8(ctrl_, vdup_n_s8(0)));
+    }
+
+private:
+    static mask_type mask(uint8x8_t bytes) noexcept {
+        return mask_type{vget_lane_u64(vreinterpret_u64_u8(bytes), 0) & 0x8080'8080'8080'8080u};
+    }
+
+    int8x8_t ctrl_;
+};
+
+#else
+
+// The control bytes of 8 slots, matched in a 64-bit integer.
+class [[nodiscard]] hash_group {
+public:
+    using mask_type = hash_group_mask<::std::uint64_t, 3u>;
+
+    static constexpr ::std::size_t width = 8u;
+
+    static_assert(::std::endian::native == ::std::endian::little);
+
+    explicit hash_group(ctrl_t const* ctrl) noexcept {
+        ::std::memcpy(&ctrl_, ctrl, sizeof(ctrl_));
+    }
+
+    // NOTE:
+    //  It may report false positives, the keys are compared anyway.
+    mask_type match(ctrl_t hash) const noexcept {
+        auto const bytes = ctrl_ ^ (lsbs * static_cast<::std::uint8_t>(hash));
+        return mask_type{(bytes - lsbs) & ~bytes & msbs};
+    }
+
+    mask_type match_empty() const noexcept {
+        return mask_type{ctrl_ & ~(ctrl_ << 6u) & msbs};
+    }
+
+    mask_type match_empty_or_deleted() const noexcept {
+        return mask_type{ctrl_ & ~(ctrl_ << 7u) & msbs};
+    }
+
+    mask_type match_full() const noexcept {
+        return mask_type{~ctrl_ & msbs};
+    }
+
+private:
+    static constexpr ::std::uint64_t lsbs = 0x0101'0101'0101'0101u;
+    static constexpr ::std::uint64_t msbs = 0x8080'8080'8080'8080u;
+
+    ::std::uint64_t ctrl_;
+};
+
+#endif
+
+// The groups of a table, visited in triangular steps from the one selected by `h1()`. Every group
+// is visited once if their number is a power of two.
+class [[nodiscard]] hash_probe {
+public:
+    hash_probe(::std::uint64_t hash, ::std::size_t group_mask) noexcept
+            : group_{h1(hash) & group_mask}, mask_{group_mask} {}
+
+    // Returns the index of the first slot of the current group.
+    ::std::size_t offset() const noexcept {
+        return group_ * hash_group::width;
+    }
+
+    void next() noexcept {
+        group_ = (group_ + ++step_) & mask_;
+    }
+
+private:
+    ::std::size_t group_;
+    ::std::size_t mask_;
+    ::std::size_t step_ = 0u;
+};
+
+} // namespace flux::fou::detail
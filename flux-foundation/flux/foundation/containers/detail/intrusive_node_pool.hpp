@@ -0,0 +1,65 @@
+#pragma once
+#include <flux/foundation/memory/memory_pool.hpp>
+
+#include <memory>
+
+namespace flux::fou::detail {
+
+// Gives the intrusive containers access to the private links of their hooks and to the hooks their
+// iterators point to.
+struct [[nodiscard]] hook_access final {
+    template <typename Hook>
+    static constexpr auto& links(Hook& hook) noexcept {
+        return hook.links_;
+    }
+
+    template <typename Iterator>
+    static constexpr auto* hook(Iterator const& iterator) noexcept {
+        return iterator.hook_;
+    }
+};
+
+// The values of an intrusive container, constructed in a `memory_pool` whose nodes have exactly
+// their size. The nodes of a block are next to each other, so are the values while they are
+// inserted in order.
+template <typename T, typename BlockOrRawAllocator>
+class [[nodiscard]] intrusive_node_pool {
+    using pool_type = memory_pool<node_pool, BlockOrRawAllocator>;
+
+    static_assert(alignof(T) <= max_alignment, "the nodes of a memory_pool are not aligned enough");
+
+public:
+    using size_type = ::std::size_t;
+
+    static constexpr size_type default_nodes_per_block = 64u;
+
+    template <typename... Args>
+    explicit intrusive_node_pool(size_type nodes_per_block, Args&&... args) noexcept
+            : pool_{sizeof(T), pool_type::min_block_size(sizeof(T), nodes_per_block),
+                    ::std::forward<Args>(args)...} {}
+
+    template <typename... Args>
+    T* create(Args&&... args) noexcept {
+        return ::std::construct_at(static_cast<T*>(pool_.allocate_node()),
+                                   ::std::forward<Args>(args)...);
+    }
+
+    void destroy(T* value) noexcept {
+        ::std::destroy_at(value);
+        pool_.deallocate_node(value);
+    }
+
+    // Frees the nodes of all values, which must have been destroyed.
+    void reset() noexcept {
+        pool_.reset();
+    }
+
+    pool_type& pool() noexcept {
+        return pool_;
+    }
+
+private:
+    pool_type pool_;
+};
+
+} // namespace flux::fou::detail
@@ -0,0 +1,494 @@
+#pragma once
+#include <flux/foundation/containers/detail/hash_group.hpp>
+#include <flux/foundation/memory/allocator_storage.hpp>
+#include <flux/foundation/memory/default_allocator.hpp>
+#include <flux/foundation/memory/relocate.hpp>
+
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace flux::fou::detail {
+
+// clang-format off
+template <typename Hash, typename KeyEqual>
+concept transparent_hash = requires {
+    typename Hash::is_transparent;
+    typename KeyEqual::is_transparent;
+};
+// clang-format on
+
+// Lookups take any key type if both the hash and the comparison are transparent, the `key_type`
+// otherwise. It is a member alias so that `K` can still be deduced.
+template <bool Transparent>
+struct [[nodiscard]] hash_key_arg final {
+    template <typename K, typename Key>
+    using type = Key;
+};
+
+template <>
+struct [[nodiscard]] hash_key_arg<true> final {
+    template <typename K, typename Key>
+    using type = K;
+};
+
+template <typename Policy, typename Hash, typename KeyEqual, raw_allocator RawAllocator>
+class raw_hash_table;
+
+// Visits the full slots of a table in memory order, it stops at the sentinel behind the last one.
+template <typename Policy, typename Value>
+class [[nodiscard]] hash_table_iterator {
+    using slot_type = typename Policy::slot_type;
+
+public:
+    using value_type        = meta::remove_cv_t<Value>;
+    using difference_type   = ::std::ptrdiff_t;
+    using reference         = Value&;
+    using pointer           = Value*;
+    using iterator_category = ::std::forward_iterator_tag;
+
+    hash_table_iterator() noexcept = default;
+
+    template <typename Other>
+        requires meta::same_as<Value, Other const>
+    hash_table_iterator(hash_table_iterator<Policy, Other> const& other) noexcept
+            : ctrl_{other.ctrl_}, slot_{other.slot_} {}
+
+    Value& operator*() const noexcept {
+        return *Policy::element(slot_);
+    }
+
+    Value* operator->() const noexcept {
+        return Policy::element(slot_);
+    }
+
+    hash_table_iterator& operator++() noexcept {
+        ++ctrl_;
+        ++slot_;
+        skip_empty_or_deleted();
+        return *this;
+    }
+
+    hash_table_iterator operator++(int) noexcept {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    friend bool operator==(hash_table_iterator const& lhs, hash_table_iterator const& rhs) noexcept {
+        return lhs.slot_ == rhs.slot_;
+    }
+
+private:
+    template <typename, typename>
+    friend class hash_table_iterator;
+
+    template <typename, typename, typename, raw_allocator>
+    friend class raw_hash_table;
+
+    hash_table_iterator(ctrl_t const* ctrl, slot_type* slot) noexcept : ctrl_{ctrl}, slot_{slot} {}
+
+    void skip_empty_or_deleted() noexcept {
+        while (is_empty_or_deleted(*ctrl_)) {
+            ++ctrl_;
+            ++slot_;
+        }
+    }
+
+    ctrl_t const* ctrl_ = nullptr;
+    slot_type*    slot_ = nullptr;
+};
+
+// The open-addressing table behind `flat_hash_map` and `flat_hash_set`, after the SwissTable of
+// Abseil. The values are stored in a single array of slots, each with a control byte that holds
+// 7 bits of the hash of its key. A lookup compares the control bytes of a whole group of slots at
+// once, with SSE2 or NEON if available, and only compares the keys of the slots that matched.
+// Groups are probed in triangular steps until one has an empty slot.
+// The slots and the control bytes share one block from the `RawAllocator`. The table grows when it
+// is 7/8 full and relocates the values with `Policy::relocate()`, which is a `memcpy` for trivially
+// relocatable values. A slot is a `Policy::slot_type`, `Policy::element()` gives its value.
+// NOTE:
+//  Inserting invalidates iterators and references if the table grows, erasing only invalidates
+//  those to the erased value.
+template <typename Policy, typename Hash, typename KeyEqual, raw_allocator RawAllocator>
+class [[nodiscard]] raw_hash_table {
+    using allocator_reference = fou::allocator_reference<RawAllocator>;
+
+    using slot_type           = typename Policy::slot_type;
+
+    static constexpr bool transparent = transparent_hash<Hash, KeyEqual>;
+
+public:
+    using key_type        = typename Policy::key_type;
+    using value_type      = typename Policy::value_type;
+    using hasher          = Hash;
+    using key_equal       = KeyEqual;
+    using allocator_type  = typename allocator_reference::allocator_type;
+    using size_type       = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+    using reference       = value_type&;
+    using const_reference = value_type const&;
+    using pointer         = value_type*;
+    using const_pointer   = value_type const*;
+    using iterator        = hash_table_iterator<Policy, value_type>;
+    using const_iterator  = hash_table_iterator<Policy, value_type const>;
+
+    template <typename K>
+    using key_arg = typename hash_key_arg<transparent>::template type<K, key_type>;
+
+    raw_hash_table() noexcept
+        requires(not is_stateful_allocator<allocator_type>::value)
+            : raw_hash_table{allocator_type{}} {}
+
+    explicit raw_hash_table(allocator_reference allocator) noexcept : allocator_{allocator} {}
+
+    // The copy allocates from the same allocator.
+    raw_hash_table(raw_hash_table const& other) noexcept
+        requires meta::copy_constructible<value_type>
+            : raw_hash_table{other.allocator_} {
+        copy_values(other);
+    }
+
+    raw_hash_table(raw_hash_table&& other) noexcept
+            : slots_{::std::exchange(other.slots_, nullptr)},
+              ctrl_{::std::exchange(other.ctrl_, nullptr)},
+              size_{::std::exchange(other.size_, 0u)},
+              capacity_{::std::exchange(other.capacity_, 0u)},
+              growth_left_{::std::exchange(other.growth_left_, 0u)},
+              allocator_{other.allocator_} {}
+
+    ~raw_hash_table() {
+        destroy_values();
+        release();
+    }
+
+    raw_hash_table& operator=(raw_hash_table const& other) noexcept
+        requires meta::copy_constructible<value_type>
+    {
+        if (this != &other) {
+            clear();
+            copy_values(other);
+        }
+        return *this;
+    }
+
+    raw_hash_table& operator=(raw_hash_table&& other) noexcept {
+        if (this != &other) {
+            destroy_values();
+            release();
+            slots_       = ::std::exchange(other.slots_, nullptr);
+            ctrl_        = ::std::exchange(other.ctrl_, nullptr);
+            size_        = ::std::exchange(other.size_, 0u);
+            capacity_    = ::std::exchange(other.capacity_, 0u);
+            growth_left_ = ::std::exchange(other.growth_left_, 0u);
+            allocator_   = other.allocator_;
+        }
+        return *this;
+    }
+
+    iterator begin() noexcept {
+        if (size_ == 0u)
+            return end();
+        iterator it{ctrl_, slots_};
+        it.skip_empty_or_deleted();
+        return it;
+    }
+    const_iterator begin() const noexcept {
+        return const_cast<raw_hash_table&>(*this).begin();
+    }
+
+    iterator end() noexcept {
+        return {ctrl_ + capacity_, slots_ + capacity_};
+    }
+    const_iterator end() const noexcept {
+        return const_cast<raw_hash_table&>(*this).end();
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0u;
+    }
+
+    // Returns the number of slots, the table grows before all of them are full.
+    size_type capacity() const noexcept {
+        return capacity_;
+    }
+
+    allocator_reference get_allocator() const noexcept {
+        return allocator_;
+    }
+
+    // Makes room for `count` values without growing.
+    void reserve(size_type count) noexcept {
+        if (count > max_load(capacity_))
+            resize(capacity_for(count));
+    }
+
+    // Destroys the values, the memory is kept.
+    void clear() noexcept {
+        destroy_values();
+        if (capacity_ != 0u) {
+            ::std::memset(ctrl_, ctrl_empty, capacity_);
+            growth_left_ = max_load(capacity_);
+        }
+        size_ = 0u;
+    }
+
+    template <typename K = key_type>
+    iterator find(key_arg<K> const& key) noexcept {
+        auto const index = find_index(key);
+        return index == npos ? end() : iterator_at(index);
+    }
+    template <typename K = key_type>
+    const_iterator find(key_arg<K> const& key) const noexcept {
+        return const_cast<raw_hash_table&>(*this).find(key);
+    }
+
+    template <typename K = key_type>
+    bool contains(key_arg<K> const& key) const noexcept {
+        return find_index(key) != npos;
+    }
+
+    // Returns an iterator to the value with the same key and `false` if there is one already.
+    ::std::pair<iterator, bool> insert(value_type const& value) noexcept
+        requires meta::copy_constructible<value_type>
+    {
+        return insert_value(value);
+    }
+
+    ::std::pair<iterator, bool> insert(value_type&& value) noexcept {
+        return insert_value(::std::move(value));
+    }
+
+    // Constructs a value and inserts it unless there is one with the same key already.
+    template <typename... Args>
+        requires(meta::nothrow_constructible<value_type, Args...>)
+    ::std::pair<iterator, bool> emplace(Args&&... args) noexcept {
+        value_type value(::std::forward<Args>(args)...);
+        return insert_value(::std::move(value));
+    }
+
+    void erase(iterator position) noexcept {
+        erase_at(index_of(position.slot_));
+    }
+
+    void erase(const_iterator position) noexcept {
+        erase_at(index_of(position.slot_));
+    }
+
+    // Returns the number of values that were erased.
+    template <typename K = key_type>
+    size_type erase(key_arg<K> const& key) noexcept {
+        auto const index = find_index(key);
+        if (index == npos)
+            return 0u;
+        erase_at(index);
+        return 1u;
+    }
+
+protected:
+    static constexpr size_type npos  = ~size_type{0u};
+    static constexpr size_type width = hash_group::width;
+
+    iterator iterator_at(size_type index) noexcept {
+        return {ctrl_ + index, slots_ + index};
+    }
+
+    // Returns the index of the value with the `key` and `false`, or the index of the slot where it
+    // has to be constructed and `true`. The slot is already counted as full.
+    template <typename K>
+    ::std::pair<size_type, bool> find_or_prepare_insert(K const& key) noexcept {
+        auto const hash = hash_of(key);
+        if (size_ != 0u) {
+            for (hash_probe probe{hash, group_mask()};; probe.next()) {
+                hash_group const group{ctrl_ + probe.offset()};
+                for (auto const i : group.match(h2(hash))) {
+                    auto const index = probe.offset() + i;
+                    if (equal_(Policy::key(*Policy::element(slots_ + index)), key)) [[likely]]
+                        return {index, false};
+                }
+                if (group.match_empty())
+                    break;
+            }
+        }
+        return {prepare_insert(hash), true};
+    }
+
+    slot_type* slots() noexcept {
+        return slots_;
+    }
+
+private:
+    // At most 7/8 of the slots are used, so that probes stay short and always find an empty slot.
+    static constexpr size_type max_load(size_type capacity) noexcept {
+        return capacity - capacity / 8u;
+    }
+
+    static constexpr size_type capacity_for(size_type count) noexcept {
+        auto capacity = width;
+        while (max_load(capacity) < count)
+            capacity *= 2u;
+        return capacity;
+    }
+
+    // The slots come first, followed by their control bytes and the sentinel.
+    static constexpr size_type block_size(size_type capacity) noexcept {
+        return capacity * sizeof(slot_type) + capacity + 1u;
+    }
+
+    template <typename K>
+    ::std::uint64_t hash_of(K const& key) const noexcept {
+        return mix_hash(static_cast<::std::uint64_t>(hash_(key)));
+    }
+
+    size_type group_mask() const noexcept {
+        return capacity_ / width - 1u;
+    }
+
+    size_type index_of(slot_type const* slot) const noexcept {
+        return static_cast<size_type>(slot - slots_);
+    }
+
+    template <typename K>
+    size_type find_index(K const& key) const noexcept {
+        if (size_ == 0u)
+            return npos;
+
+        auto const hash = hash_of(key);
+        for (hash_probe probe{hash, group_mask()};; probe.next()) {
+            hash_group const group{ctrl_ + probe.offset()};
+            for (auto const i : group.match(h2(hash))) {
+                auto const index = probe.offset() + i;
+                if (equal_(Policy::key(*Policy::element(slots_ + index)), key)) [[likely]]
+                    return index;
+            }
+            if (group.match_empty())
+                return npos;
+        }
+    }
+
+    size_type find_first_non_full(::std::uint64_t hash) const noexcept {
+        for (hash_probe probe{hash, group_mask()};; probe.next()) {
+            if (auto const mask = hash_group{ctrl_ + probe.offset()}.match_empty_or_deleted())
+                return probe.offset() + mask.lowest();
+        }
+    }
+
+    // Claims a slot for a value with the `hash`, which must not be in the table yet.
+    size_type prepare_insert(::std::uint64_t hash) noexcept {
+        auto index = capacity_ == 0u ? npos : find_first_non_full(hash);
+        // A deleted slot can be reused without growing.
+        if (growth_left_ == 0u && (index == npos || ctrl_[index] != ctrl_deleted)) [[unlikely]] {
+            grow();
+            index = find_first_non_full(hash);
+        }
+
+        growth_left_ -= ctrl_[index] == ctrl_empty ? 1u : 0u;
+        ctrl_[index] = h2(hash);
+        ++size_;
+        return index;
+    }
+
+    template <typename Value>
+    ::std::pair<iterator, bool> insert_value(Value&& value) noexcept {
+        auto const [index, inserted] = find_or_prepare_insert(Policy::key(value));
+        if (inserted)
+            ::std::construct_at(Policy::element(slots_ + index), ::std::forward<Value>(value));
+        return {iterator_at(index), inserted};
+    }
+
+    void copy_values(raw_hash_table const& other) noexcept {
+        reserve(other.size_);
+        for (auto const& value : other) {
+            auto const index = prepare_insert(hash_of(Policy::key(value)));
+            ::std::construct_at(Policy::element(slots_ + index), value);
+        }
+    }
+
+    void erase_at(size_type index) noexcept {
+        ::std::destroy_at(Policy::element(slots_ + index));
+        --size_;
+        // Probes only continue past groups without empty slots. If the group already has one, no
+        // probe passes it and the slot can be emptied rather than marked as deleted.
+        if (hash_group{ctrl_ + (index & ~(width - 1u))}.match_empty()) {
+            ctrl_[index] = ctrl_empty;
+            ++growth_left_;
+        } else {
+            ctrl_[index] = ctrl_deleted;
+        }
+    }
+
+    // Doubles the capacity, unless most of the used slots are deleted ones, which are dropped by
+    // rehashing at the same capacity.
+    void grow() noexcept {
+        if (capacity_ == 0u)
+            resize(width);
+        else if (size_ <= max_load(capacity_) / 2u)
+            resize(capacity_);
+        else
+            resize(capacity_ * 2u);
+    }
+
+    void resize(size_type capacity) noexcept {
+        auto* const old_slots    = slots_;
+        auto* const old_ctrl     = ctrl_;
+        auto const  old_capacity = capacity_;
+
+        slots_ = static_cast<slot_type*>(
+                allocator_.allocate_node(block_size(capacity), alignof(slot_type)));
+        ctrl_  = reinterpret_cast<ctrl_t*>(slots_ + capacity);
+        ::std::memset(ctrl_, ctrl_empty, capacity);
+        ctrl_[capacity] = ctrl_sentinel;
+        capacity_       = capacity;
+        growth_left_    = max_load(capacity) - size_;
+
+        for (size_type group = 0u; group < old_capacity; group += width) {
+            for (auto const i : hash_group{old_ctrl + group}.match_full()) {
+                auto* const slot  = old_slots + group + i;
+                auto const  hash  = hash_of(Policy::key(*Policy::element(slot)));
+                auto const  index = find_first_non_full(hash);
+                ctrl_[index]      = h2(hash);
+                Policy::relocate(slot, slots_ + index);
+            }
+        }
+
+        if (old_slots)
+            allocator_.deallocate_node(old_slots, block_size(old_capacity), alignof(slot_type));
+    }
+
+    void destroy_values() noexcept {
+        if constexpr (not meta::trivially_destructible<value_type>) {
+            for (size_type group = 0u; group < capacity_; group += width) {
+                for (auto const i : hash_group{ctrl_ + group}.match_full())
+                    ::std::destroy_at(Policy::element(slots_ + group + i));
+            }
+        }
+    }
+
+    // Frees the memory, the values must have been destroyed.
+    void release() noexcept {
+        if (slots_) {
+            allocator_.deallocate_node(slots_, block_size(capacity_), alignof(slot_type));
+            slots_       = nullptr;
+            ctrl_        = nullptr;
+            capacity_    = 0u;
+            growth_left_ = 0u;
+        }
+    }
+
+    slot_type*          slots_       = nullptr;
+    ctrl_t*             ctrl_        = nullptr;
+    size_type           size_        = 0u;
+    size_type           capacity_    = 0u;
+    size_type           growth_left_ = 0u;
+    allocator_reference allocator_;
+
+    FLUX_NO_UNIQUE_ADDRESS Hash     hash_;
+    FLUX_NO_UNIQUE_ADDRESS KeyEqual equal_;
+};
+
+} // namespace flux::fou::detail
@@ -0,0 +1,48 @@
+#pragma once
+#include <flux/meta/type_traits.hpp>
+
+#include <utility>
+
+namespace flux::fou {
+
+// Owns an `int` like a `unique_ptr`, it may be relocated as bytes.
+struct [[nodiscard]] owner final {
+    using trivially_relocatable = meta::true_type;
+
+    explicit owner(int v) noexcept : value{new int{v}} {}
+    owner(owner&& other) noexcept : value{::std::exchange(other.value, nullptr)} {}
+    owner& operator=(owner&& other) noexcept {
+        delete ::std::exchange(value, ::std::exchange(other.value, nullptr));
+        return *this;
+    }
+    ~owner() {
+        delete value;
+    }
+
+    int* value;
+};
+
+// Knows its own address, it must be relocated by its move constructor.
+struct [[nodiscard]] self_aware final {
+    explicit self_aware(int v = 0) noexcept : self{this}, value{v} {}
+    self_aware(self_aware const& other) noexcept : self{this}, value{other.value} {}
+    self_aware(self_aware&& other) noexcept : self{this}, value{other.value} {}
+    ~self_aware() {
+        self = nullptr;
+    }
+
+    self_aware* self;
+    int         value;
+};
+
+// Whether every `self_aware` of the `range` is where it thinks it is.
+template <typename Range>
+bool is_valid(Range const& range) noexcept {
+    for (auto const& value : range) {
+        if (value.self != &value)
+            return false;
+    }
+    return true;
+}
+
+} // namespace flux::fou
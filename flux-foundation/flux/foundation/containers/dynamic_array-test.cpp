@@ -0,0 +1,153 @@
+#include <flux/foundation.hpp>
+#include <flux/foundation/containers/detail/test_types.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+
+using namespace flux;
+using namespace flux::fou;
+
+static_assert(meta::trivially_relocatable<owner>);
+static_assert(not meta::trivially_relocatable<self_aware>);
+
+TEST_CASE("fou::dynamic_array", "[flux-containers/dynamic_array.hpp]") {
+    dynamic_array<int> array;
+    CHECK(array.empty());
+    CHECK(array.capacity() == 0u);
+
+    for (int i = 0; i < 100; ++i)
+        array.push_back(i);
+    CHECK(array.size() == 100u);
+    CHECK(array.capacity() >= 100u);
+    CHECK(array.front() == 0);
+    CHECK(array.back() == 99);
+    for (int i = 0; i < 100; ++i)
+        CHECK(array[static_cast<::std::size_t>(i)] == i);
+
+    SECTION("pop_back and resize") {
+        array.pop_back();
+        CHECK(array.size() == 99u);
+        array.resize(10u);
+        CHECK(array.size() == 10u);
+        CHECK(array.back() == 9);
+        array.resize(12u, 7);
+        CHECK(array[10u] == 7);
+        CHECK(array[11u] == 7);
+        array.resize(14u);
+        CHECK(array[13u] == 0);
+    }
+    SECTION("insert and erase") {
+        int const values[] = {-1, -2, -3};
+        auto      it       = array.insert(array.begin() + 10, values, values + 3);
+        CHECK(it == array.begin() + 10);
+        CHECK(array.size() == 103u);
+        CHECK(array[9u] == 9);
+        CHECK(array[10u] == -1);
+        CHECK(array[12u] == -3);
+        CHECK(array[13u] == 10);
+        CHECK(array.back() == 99);
+
+        it = array.erase(array.begin() + 10, array.begin() + 13);
+        CHECK(*it == 10);
+        for (int i = 0; i < 100; ++i)
+            CHECK(array[static_cast<::std::size_t>(i)] == i);
+
+        array.insert(array.begin(), -1);
+        CHECK(array.front() == -1);
+        array.erase(array.begin());
+        CHECK(array.front() == 0);
+    }
+    SECTION("copy and move") {
+        auto copy = array;
+        CHECK(copy.size() == 100u);
+        CHECK(copy.back() == 99);
+
+        auto moved = ::std::move(copy);
+        CHECK(moved.size() == 100u);
+        CHECK(copy.empty());
+
+        copy = moved;
+        CHECK(copy.size() == 100u);
+        moved = dynamic_array<int>{1, 2, 3};
+        CHECK(moved.size() == 3u);
+        CHECK(moved[2u] == 3);
+    }
+    SECTION("shrink_to_fit") {
+        array.resize(3u);
+        array.shrink_to_fit();
+        CHECK(array.size() == 3u);
+        CHECK(array.capacity() >= 3u);
+        CHECK(array.back() == 2);
+
+        array.clear();
+        array.shrink_to_fit();
+        CHECK(array.capacity() == 0u);
+    }
+    SECTION("a value of its own") {
+        array.shrink_to_fit();
+        array.push_back(array.front());
+        CHECK(array.back() == 0);
+        array.emplace(array.begin(), array.back());
+        CHECK(array.front() == 0);
+    }
+}
+
+TEST_CASE("fou::dynamic_array relocation", "[flux-containers/dynamic_array.hpp]") {
+    SECTION("trivially relocatable") {
+        dynamic_array<owner> array;
+        for (int i = 0; i < 50; ++i)
+            array.emplace_back(i);
+        array.emplace(array.begin() + 25, -1);
+        CHECK(*array[25u].value == -1);
+        CHECK(*array[26u].value == 25);
+        array.erase(array.begin() + 25);
+        for (int i = 0; i < 50; ++i)
+            CHECK(*array[static_cast<::std::size_t>(i)].value == i);
+    }
+    SECTION("not trivially relocatable") {
+        dynamic_array<self_aware> array;
+        for (int i = 0; i < 50; ++i)
+            array.emplace_back(i);
+        CHECK(is_valid(array));
+
+        self_aware const values[] = {self_aware{-1}, self_aware{-2}};
+        array.insert(array.begin() + 25, values, values + 2);
+        CHECK(is_valid(array));
+        CHECK(array[25u].value == -1);
+        CHECK(array[27u].value == 25);
+
+        array.erase(array.begin() + 25, array.begin() + 27);
+        CHECK(is_valid(array));
+        for (int i = 0; i < 50; ++i)
+            CHECK(array[static_cast<::std::size_t>(i)].value == i);
+    }
+    SECTION("non-trivial values") {
+        dynamic_array<::std::string> array{"a", "b", "c"};
+        array.insert(array.begin() + 1, ::std::string(32u, 'x'));
+        CHECK(array[1u] == ::std::string(32u, 'x'));
+        CHECK(array[2u] == "b");
+    }
+}
+
+TEST_CASE("fou::dynamic_array expand in place", "[flux-containers/dynamic_array.hpp]") {
+    memory_stack<>                     stack{4096u};
+    dynamic_array<int, memory_stack<>> array{stack};
+
+    array.reserve(4u);
+    auto const* data = array.data();
+    for (int i = 0; i < 64; ++i)
+        array.push_back(i);
+    // The array is the last allocation of the stack, it grows in place.
+    CHECK(array.data() == data);
+    CHECK(array.size() == 64u);
+    CHECK(array.back() == 63);
+
+    // Another allocation is in the way now.
+    auto*      node     = allocator_traits<memory_stack<>>::allocate_node(stack, 16u, 8u);
+    auto const capacity = array.capacity();
+    array.resize(capacity + 1u);
+    CHECK(array.data() != data);
+    CHECK(array[63u] == 63);
+    allocator_traits<memory_stack<>>::deallocate_node(stack, node, 16u, 8u);
+}
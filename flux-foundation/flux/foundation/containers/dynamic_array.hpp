@@ -0,0 +1,414 @@
+#pragma once
+#include <flux/foundation/containers/detail/gap.hpp>
+#include <flux/foundation/memory/allocator_storage.hpp>
+#include <flux/foundation/memory/default_allocator.hpp>
+#include <flux/foundation/memory/uninitialized_algorithms.hpp>
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+
+namespace flux::fou {
+
+// A contiguous array of `T` that grows on demand like `std::vector`, its memory comes from a
+// `RawAllocator`. When it runs out of capacity, it first asks the allocator to expand the memory
+// in place and, for trivially relocatable `T`, to `realloc()` it. Only then it allocates new memory
+// and relocates the values, which is a single `memmove` for trivially relocatable `T`.
+// New memory is allocated with `allocate_at_least()`, whatever the allocator has rounded the size
+// up to is used as capacity.
+// NOTE:
+//  Growing invalidates pointers and iterators to the values, unless the memory has been expanded
+//  in place.
+template <meta::nothrow_move_constructible T, raw_allocator RawAllocator = default_allocator>
+    requires meta::nothrow_destructible<T>
+class [[nodiscard]] dynamic_array {
+    using allocator_reference = allocator_reference<RawAllocator>;
+
+public:
+    using value_type      = T;
+    using allocator_type  = typename allocator_reference::allocator_type;
+    using size_type       = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+    using reference       = T&;
+    using const_reference = T const&;
+    using pointer         = T*;
+    using const_pointer   = T const*;
+    using iterator        = T*;
+    using const_iterator  = T const*;
+
+    dynamic_array() noexcept
+        requires(not is_stateful_allocator<allocator_type>::value)
+            : dynamic_array{allocator_type{}} {}
+
+    explicit dynamic_array(allocator_reference allocator) noexcept : allocator_{allocator} {}
+
+    // Constructs `count` value-initialized values.
+    explicit dynamic_array(size_type count) noexcept
+        requires(not is_stateful_allocator<allocator_type>::value and
+                 meta::default_initializable<T>)
+            : dynamic_array{count, allocator_type{}} {}
+
+    dynamic_array(size_type count, allocator_reference allocator) noexcept
+        requires meta::default_initializable<T>
+            : dynamic_array{allocator} {
+        resize(count);
+    }
+
+    dynamic_array(::std::initializer_list<T> values) noexcept
+        requires(not is_stateful_allocator<allocator_type>::value and meta::copy_constructible<T>)
+            : dynamic_array{values, allocator_type{}} {}
+
+    dynamic_array(::std::initializer_list<T> values, allocator_reference allocator) noexcept
+        requires meta::copy_constructible<T>
+            : dynamic_array{allocator} {
+        insert(end(), values.begin(), values.end());
+    }
+
+    // The copy allocates from the same allocator.
+    dynamic_array(dynamic_array const& other) noexcept
+        requires meta::copy_constructible<T>
+            : dynamic_array{other.allocator_} {
+        insert(end(), other.begin(), other.end());
+    }
+
+    dynamic_array(dynamic_array&& other) noexcept
+            : data_{::std::exchange(other.data_, nullptr)},
+              size_{::std::exchange(other.size_, 0u)},
+              storage_size_{::std::exchange(other.storage_size_, 0u)},
+              allocator_{other.allocator_} {}
+
+    ~dynamic_array() {
+        clear();
+        release();
+    }
+
+    dynamic_array& operator=(dynamic_array const& other) noexcept
+        requires meta::copy_constructible<T>
+    {
+        if (this != &other) {
+            clear();
+            insert(end(), other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    dynamic_array& operator=(dynamic_array&& other) noexcept {
+        if (this != &other) {
+            clear();
+            release();
+            data_         = ::std::exchange(other.data_, nullptr);
+            size_         = ::std::exchange(other.size_, 0u);
+            storage_size_ = ::std::exchange(other.storage_size_, 0u);
+            allocator_    = other.allocator_;
+        }
+        return *this;
+    }
+
+    iterator begin() noexcept {
+        return data_;
+    }
+    const_iterator begin() const noexcept {
+        return data_;
+    }
+
+    iterator end() noexcept {
+        return data_ + size_;
+    }
+    const_iterator end() const noexcept {
+        return data_ + size_;
+    }
+
+    T& operator[](size_type index) noexcept {
+        FLUX_ASSERT(index < size_);
+        return data_[index];
+    }
+    T const& operator[](size_type index) const noexcept {
+        FLUX_ASSERT(index < size_);
+        return data_[index];
+    }
+
+    T& front() noexcept {
+        return (*this)[0u];
+    }
+    T const& front() const noexcept {
+        return (*this)[0u];
+    }
+
+    T& back() noexcept {
+        return (*this)[size_ - 1u];
+    }
+    T const& back() const noexcept {
+        return (*this)[size_ - 1u];
+    }
+
+    T* data() noexcept {
+        return data_;
+    }
+    T const* data() const noexcept {
+        return data_;
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0u;
+    }
+
+    size_type capacity() const noexcept {
+        return storage_size_ / sizeof(T);
+    }
+
+    allocator_reference get_allocator() const noexcept {
+        return allocator_;
+    }
+
+    // Makes room for at least `count` values.
+    void reserve(size_type count) noexcept {
+        if (count > capacity() && !try_grow_in_place(count))
+            reallocate(count);
+    }
+
+    // Moves the values to memory that just fits them, or frees it if there are none.
+    void shrink_to_fit() noexcept {
+        if (size_ == capacity())
+            return;
+        if (size_ == 0u)
+            release();
+        else
+            reallocate(size_);
+    }
+
+    void clear() noexcept {
+        ::std::destroy(begin(), end());
+        size_ = 0u;
+    }
+
+    // Value-initializes new values or destroys those beyond `count`.
+    void resize(size_type count) noexcept
+        requires meta::default_initializable<T>
+    {
+        if (count > size_) {
+            reserve_for(count);
+            ranges::uninitialized_value_construct_n(end(),
+                                                    static_cast<difference_type>(count - size_));
+        } else {
+            ::std::destroy(begin() + count, end());
+        }
+        size_ = count;
+    }
+
+    void resize(size_type count, T const& value) noexcept
+        requires meta::copy_constructible<T>
+    {
+        if (count > size_) {
+            if (count > capacity()) {
+                // The `value` may be one of ours.
+                T copy{value};
+                reserve_for(count);
+                ::std::uninitialized_fill(end(), begin() + count, copy);
+            } else {
+                ::std::uninitialized_fill(end(), begin() + count, value);
+            }
+        } else {
+            ::std::destroy(begin() + count, end());
+        }
+        size_ = count;
+    }
+
+    template <typename... Args>
+        requires meta::nothrow_constructible<T, Args...>
+    T& emplace_back(Args&&... args) noexcept {
+        if (size_ == capacity()) [[unlikely]] {
+            // The `args` may refer to our values, which are about to move.
+            T value(::std::forward<Args>(args)...);
+            reserve_for(size_ + 1u);
+            ::std::construct_at(end(), ::std::move(value));
+        } else {
+            ::std::construct_at(end(), ::std::forward<Args>(args)...);
+        }
+        return data_[size_++];
+    }
+
+    void push_back(T const& value) noexcept
+        requires meta::copy_constructible<T>
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) noexcept {
+        emplace_back(::std::move(value));
+    }
+
+    void pop_back() noexcept {
+        FLUX_ASSERT(!empty());
+        ::std::destroy_at(data_ + --size_);
+    }
+
+    // Constructs a value before `position` and returns an iterator to it.
+    template <typename... Args>
+        requires meta::nothrow_constructible<T, Args...>
+    iterator emplace(const_iterator position, Args&&... args) noexcept {
+        auto const index = static_cast<size_type>(position - begin());
+        FLUX_ASSERT(index <= size_);
+        if (index == size_) {
+            emplace_back(::std::forward<Args>(args)...);
+            return begin() + index;
+        }
+
+        // The `args` may refer to our values, which are about to move.
+        T    value(::std::forward<Args>(args)...);
+        auto gap = open_gap(index, 1u);
+        ::std::construct_at(gap, ::std::move(value));
+        ++size_;
+        return gap;
+    }
+
+    iterator insert(const_iterator position, T const& value) noexcept
+        requires meta::copy_constructible<T>
+    {
+        return emplace(position, value);
+    }
+
+    iterator insert(const_iterator position, T&& value) noexcept {
+        return emplace(position, ::std::move(value));
+    }
+
+    // Copies the values of `[first, last)` before `position`, with a single `memcpy` if they are
+    // contiguous and trivially copyable. Returns an iterator to the first of them.
+    // NOTE:
+    //  The values must not be part of this array.
+    template <meta::forward_iterator Iterator, meta::sentinel_for<Iterator> Sentinel>
+        requires meta::constructible_from<T, meta::iter_ref_t<Iterator>>
+    iterator insert(const_iterator position, Iterator first, Sentinel last) noexcept {
+        auto const index = static_cast<size_type>(position - begin());
+        auto const count = static_cast<size_type>(::std::ranges::distance(first, last));
+        FLUX_ASSERT(index <= size_);
+        if (count == 0u)
+            return begin() + index;
+
+        auto gap = open_gap(index, count);
+        if constexpr (meta::contiguous_iterator<Iterator> and
+                      meta::same_as<meta::iter_value_t<Iterator>, T> and
+                      meta::trivially_copyable<T>) {
+            detail::constexpr_memcpy(gap, detail::to_address(first), count);
+        } else {
+            ranges::uninitialized_copy_no_overlap(::std::move(first), ::std::move(last), gap);
+        }
+        size_ += count;
+        return gap;
+    }
+
+    iterator insert(const_iterator position, ::std::initializer_list<T> values) noexcept
+        requires meta::copy_constructible<T>
+    {
+        return insert(position, values.begin(), values.end());
+    }
+
+    iterator erase(const_iterator position) noexcept {
+        return erase(position, position + 1);
+    }
+
+    // Destroys the values of `[first, last)` and closes the gap, returns an iterator to the value
+    // that followed them.
+    iterator erase(const_iterator first, const_iterator last) noexcept {
+        auto const index = static_cast<size_type>(first - begin());
+        auto const count = static_cast<size_type>(last - first);
+        FLUX_ASSERT(index + count <= size_);
+
+        auto* const gap = begin() + index;
+        detail::close_gap(gap, end(), count);
+        size_ -= count;
+        return gap;
+    }
+
+private:
+    static constexpr size_type bytes(size_type count) noexcept {
+        return count * sizeof(T);
+    }
+
+    // Grows by half of the capacity at least, so that appending takes amortized constant time.
+    size_type grown_capacity(size_type count) const noexcept {
+        return ::std::max(count, capacity() + capacity() / 2u);
+    }
+
+    // Makes room for `count` values, growing the capacity geometrically.
+    void reserve_for(size_type count) noexcept {
+        if (count > capacity()) {
+            auto const new_capacity = grown_capacity(count);
+            if (!try_grow_in_place(new_capacity))
+                reallocate(new_capacity);
+        }
+    }
+
+    // Grows the memory to `count` values without relocating them one by one. It is expanded in
+    // place, or moved by `realloc()` if the values may be relocated as bytes.
+    bool try_grow_in_place(size_type count) noexcept {
+        if (!data_)
+            return false;
+
+        if (allocator_.try_expand(data_, storage_size_, bytes(count), alignof(T))) {
+            storage_size_ = bytes(count);
+            return true;
+        }
+        if constexpr (meta::trivially_relocatable<T>) {
+            if (auto* memory =
+                        allocator_.try_reallocate(data_, storage_size_, bytes(count), alignof(T))) {
+                data_         = static_cast<T*>(memory);
+                storage_size_ = bytes(count);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Relocates the values to new memory for at least `count` values, leaving `gap` uninitialized
+    // values in front of the one at `index`.
+    void reallocate(size_type count, size_type index = 0u, size_type gap = 0u) noexcept {
+        FLUX_ASSERT(count >= size_ + gap);
+        auto const block = allocator_.allocate_at_least(bytes(count), alignof(T));
+        auto*      data  = static_cast<T*>(block.memory);
+
+        ranges::uninitialized_relocate_no_overlap(begin(), begin() + index, data);
+        ranges::uninitialized_relocate_no_overlap(begin() + index, end(), data + index + gap);
+
+        release();
+        data_         = data;
+        storage_size_ = block.size;
+    }
+
+    // Makes room for `count` uninitialized values in front of the one at `index`, and returns the
+    // first of them. The size is left unchanged.
+    T* open_gap(size_type index, size_type count) noexcept {
+        auto const required = size_ + count;
+        if (required > capacity()) {
+            auto const new_capacity = grown_capacity(required);
+            if (!try_grow_in_place(new_capacity)) {
+                reallocate(new_capacity, index, count);
+                return data_ + index;
+            }
+        }
+
+        auto* const gap = data_ + index;
+        detail::open_gap(gap, end(), count);
+        return gap;
+    }
+
+    // Frees the memory, the values must have been destroyed or relocated.
+    void release() noexcept {
+        if (data_) {
+            allocator_.deallocate_node(data_, storage_size_, alignof(T));
+            data_         = nullptr;
+            storage_size_ = 0u;
+        }
+    }
+
+    T*                  data_         = nullptr;
+    size_type           size_         = 0u;
+    size_type           storage_size_ = 0u;
+    allocator_reference allocator_;
+};
+
+} // namespace flux::fou
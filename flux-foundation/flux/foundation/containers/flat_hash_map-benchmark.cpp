@@ -0,0 +1,95 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace flux::fou;
+
+namespace {
+
+constexpr ::std::size_t count = 10000u;
+
+// Spreads the keys over the whole range of `std::uint64_t`, like entity ids with a version.
+::std::vector<::std::uint64_t> make_keys(::std::uint64_t seed) {
+    ::std::vector<::std::uint64_t> keys(count);
+    for (auto& key : keys) {
+        seed += 0x9e37'79b9'7f4a'7c15u;
+        key = seed;
+    }
+    return keys;
+}
+
+// Strings as long as typical component or asset names.
+::std::vector<::std::string> make_names(::std::string const& prefix) {
+    ::std::vector<::std::string> names(count);
+    for (::std::size_t i = 0u; i < count; ++i)
+        names[i] = prefix + "/component_" + ::std::to_string(i);
+    return names;
+}
+
+template <typename Map, typename Key>
+Map filled(::std::vector<Key> const& keys) {
+    Map map;
+    for (::std::size_t i = 0u; i < keys.size(); ++i)
+        map.try_emplace(keys[i], i);
+    return map;
+}
+
+template <typename Map, typename Key>
+void benchmark_map(char const* name, ::std::vector<Key> const& keys,
+                   ::std::vector<Key> const& missing) {
+    auto const map = filled<Map>(keys);
+
+    BENCHMARK(::std::string{name} + " insert") {
+        return filled<Map>(keys).size();
+    };
+    BENCHMARK(::std::string{name} + " find hit") {
+        ::std::size_t sum = 0u;
+        for (auto const& key : keys)
+            sum += map.find(key)->second;
+        return sum;
+    };
+    BENCHMARK(::std::string{name} + " find miss") {
+        ::std::size_t found = 0u;
+        for (auto const& key : missing)
+            found += map.find(key) != map.end();
+        return found;
+    };
+    BENCHMARK_ADVANCED(::std::string{name} + " erase")(Catch::Benchmark::Chronometer meter) {
+        ::std::vector<Map> maps;
+        for (int i = 0; i < meter.runs(); ++i)
+            maps.push_back(filled<Map>(keys));
+        meter.measure([&](int run) {
+            for (auto const& key : keys)
+                maps[static_cast<::std::size_t>(run)].erase(key);
+        });
+    };
+    BENCHMARK(::std::string{name} + " iterate") {
+        ::std::size_t sum = 0u;
+        for (auto const& [key, value] : map)
+            sum += value;
+        return sum;
+    };
+}
+
+} // namespace
+
+TEST_CASE("fou::flat_hash_map integer keys", "[flux-containers/flat_hash_map.hpp]") {
+    auto const keys    = make_keys(1u);
+    auto const missing = make_keys(2u);
+    benchmark_map<flat_hash_map<::std::uint64_t, ::std::size_t>>("flat_hash_map", keys, missing);
+    benchmark_map<::std::unordered_map<::std::uint64_t, ::std::size_t>>("std::unordered_map", keys,
+                                                                        missing);
+}
+
+TEST_CASE("fou::flat_hash_map string keys", "[flux-containers/flat_hash_map.hpp]") {
+    auto const keys    = make_names("assets");
+    auto const missing = make_names("missing");
+    benchmark_map<flat_hash_map<::std::string, ::std::size_t>>("flat_hash_map", keys, missing);
+    benchmark_map<::std::unordered_map<::std::string, ::std::size_t>>("std::unordered_map", keys,
+                                                                      missing);
+}
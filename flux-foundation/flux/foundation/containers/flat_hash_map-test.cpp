@@ -0,0 +1,152 @@
+#include <flux/foundation.hpp>
+#include <flux/foundation/containers/detail/test_types.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <string_view>
+
+using namespace flux;
+using namespace flux::fou;
+
+namespace {
+
+struct [[nodiscard]] string_hash final {
+    using is_transparent = void;
+
+    ::std::size_t operator()(::std::string_view string) const noexcept {
+        return ::std::hash<::std::string_view>{}(string);
+    }
+};
+
+// Sends every key to the same group, so that lookups have to probe past full groups.
+struct [[nodiscard]] colliding_hash final {
+    ::std::size_t operator()(int) const noexcept {
+        return 42u;
+    }
+};
+
+} // namespace
+
+TEST_CASE("fou::flat_hash_map", "[flux-containers/flat_hash_map.hpp]") {
+    flat_hash_map<int, int> map;
+    CHECK(map.empty());
+    CHECK(map.begin() == map.end());
+    CHECK(map.find(0) == map.end());
+
+    for (int i = 0; i < 1000; ++i)
+        CHECK(map.insert({i, i * 2}).second);
+    CHECK(map.size() == 1000u);
+    CHECK(map.capacity() >= 1000u);
+    for (int i = 0; i < 1000; ++i) {
+        auto it = map.find(i);
+        REQUIRE(it != map.end());
+        CHECK(it->second == i * 2);
+    }
+    CHECK(!map.contains(1000));
+
+    SECTION("iteration") {
+        ::std::size_t count = 0u;
+        long          sum   = 0;
+        for (auto const& [key, value] : map) {
+            ++count;
+            sum += value;
+        }
+        CHECK(count == 1000u);
+        CHECK(sum == 999 * 1000);
+    }
+    SECTION("erase") {
+        for (int i = 0; i < 1000; i += 2)
+            CHECK(map.erase(i) == 1u);
+        CHECK(map.erase(0) == 0u);
+        CHECK(map.size() == 500u);
+        for (int i = 0; i < 1000; ++i)
+            CHECK(map.contains(i) == (i % 2 != 0));
+
+        // The slots that have been freed are reused.
+        auto const capacity = map.capacity();
+        for (int i = 0; i < 1000; i += 2)
+            map.insert({i, i});
+        CHECK(map.capacity() == capacity);
+        CHECK(map.size() == 1000u);
+
+        map.erase(map.find(1));
+        CHECK(!map.contains(1));
+    }
+    SECTION("subscript and try_emplace") {
+        CHECK(map[5] == 10);
+        map[5] = 0;
+        CHECK(map.find(5)->second == 0);
+        CHECK(map[2000] == 0);
+        CHECK(map.size() == 1001u);
+
+        auto [it, inserted] = map.try_emplace(6, 0);
+        CHECK(!inserted);
+        CHECK(it->second == 12);
+        CHECK(!map.insert_or_assign(6, 1).second);
+        CHECK(map[6] == 1);
+        CHECK(map.insert_or_assign(3000, 1).second);
+        CHECK(map.emplace(3001, 2).second);
+        CHECK(map[3001] == 2);
+    }
+    SECTION("copy, move and clear") {
+        auto copy = map;
+        CHECK(copy.size() == 1000u);
+        CHECK(copy.find(999)->second == 1998);
+
+        auto moved = ::std::move(copy);
+        CHECK(moved.size() == 1000u);
+        CHECK(copy.empty());
+
+        auto const capacity = moved.capacity();
+        moved.clear();
+        CHECK(moved.empty());
+        CHECK(moved.capacity() == capacity);
+        CHECK(moved.find(1) == moved.end());
+        moved[1] = 1;
+        CHECK(moved.size() == 1u);
+    }
+}
+
+TEST_CASE("fou::flat_hash_map keys and values", "[flux-containers/flat_hash_map.hpp]") {
+    SECTION("transparent lookup") {
+        flat_hash_map<::std::string, int, string_hash, ::std::equal_to<>> map{
+                {"one", 1}, {"two", 2}, {"three", 3}};
+        CHECK(map.size() == 3u);
+        CHECK(map.find(::std::string_view{"two"})->second == 2);
+        CHECK(map.contains("three"));
+        CHECK(map.erase("one") == 1u);
+        CHECK(!map.contains("one"));
+
+        for (int i = 0; i < 100; ++i)
+            map[::std::to_string(i) + ::std::string(32u, 'x')] = i;
+        CHECK(map.size() == 102u);
+        CHECK(map.find(::std::string{"42"} + ::std::string(32u, 'x'))->second == 42);
+    }
+    SECTION("colliding hashes") {
+        flat_hash_map<int, int, colliding_hash> map;
+        for (int i = 0; i < 100; ++i)
+            map[i] = i;
+        for (int i = 0; i < 100; i += 3)
+            map.erase(i);
+        for (int i = 0; i < 100; ++i)
+            CHECK(map.contains(i) == (i % 3 != 0));
+    }
+    SECTION("not trivially relocatable") {
+        flat_hash_map<int, self_aware> map;
+        for (int i = 0; i < 200; ++i)
+            map.try_emplace(i, i);
+        for (auto const& [key, value] : map) {
+            CHECK(value.self == &value);
+            CHECK(value.value == key);
+        }
+    }
+    SECTION("any allocator") {
+        memory_stack<>                                                           stack{1u << 16u};
+        flat_hash_map<int, int, ::std::hash<int>, ::std::equal_to<int>, memory_stack<>> map{stack};
+        for (int i = 0; i < 100; ++i)
+            map[i] = i;
+        CHECK(map.size() == 100u);
+        CHECK(map[99] == 99);
+    }
+}
@@ -0,0 +1,137 @@
+#pragma once
+#include <flux/foundation/containers/detail/raw_hash_table.hpp>
+
+#include <functional>
+#include <new>
+#include <tuple>
+
+namespace flux::fou {
+
+namespace detail {
+
+template <typename Key, typename T>
+struct [[nodiscard]] hash_map_policy final {
+    using key_type    = Key;
+    using mapped_type = T;
+    using value_type  = ::std::pair<Key const, T>;
+
+    // The key is only const to users: a slot holds the pair as both types, like the slots of
+    // Abseil's maps, so that the key can be moved from through the mutable one as the pair is
+    // relocated.
+    union [[nodiscard]] slot_type {
+        slot_type() noexcept {}
+        ~slot_type() {}
+
+        value_type          value;
+        ::std::pair<Key, T> mutable_value;
+    };
+
+    static Key const& key(value_type const& value) noexcept {
+        return value.first;
+    }
+
+    static value_type* element(slot_type* slot) noexcept {
+        return ::std::launder(&slot->value);
+    }
+
+    static void relocate(slot_type* src, slot_type* dest) noexcept {
+        if constexpr (meta::trivially_relocatable<value_type>) {
+            relocate_at(element(src), &dest->value);
+        } else {
+            auto* const from = ::std::launder(&src->mutable_value);
+            ::std::construct_at(&dest->mutable_value, ::std::move(*from));
+            ::std::destroy_at(from);
+        }
+    }
+};
+
+} // namespace detail
+
+// A map of unique keys to values in an open-addressing hash table, see `detail::raw_hash_table`.
+// Unlike `std::unordered_map` there is no allocation per value, the pairs are stored in the table
+// itself.
+// NOTE:
+//  Inserting invalidates iterators and references if the table grows. The arguments of
+//  `try_emplace()` must not refer to values of the map.
+template <meta::nothrow_move_constructible Key, meta::nothrow_move_constructible T,
+          typename Hash = ::std::hash<Key>, typename KeyEqual = ::std::equal_to<Key>,
+          raw_allocator RawAllocator = default_allocator>
+    requires(meta::nothrow_destructible<Key> and meta::nothrow_destructible<T>)
+class [[nodiscard]] flat_hash_map
+        : public detail::raw_hash_table<detail::hash_map_policy<Key, T>, Hash, KeyEqual,
+                                        RawAllocator> {
+    using base =
+            detail::raw_hash_table<detail::hash_map_policy<Key, T>, Hash, KeyEqual, RawAllocator>;
+
+public:
+    using mapped_type = T;
+    using typename base::iterator;
+    using typename base::key_type;
+    using typename base::size_type;
+    using typename base::value_type;
+
+    using base::base;
+
+    flat_hash_map() noexcept = default;
+
+    flat_hash_map(::std::initializer_list<value_type> values) noexcept
+        requires(not is_stateful_allocator<typename base::allocator_type>::value and
+                 meta::copy_constructible<value_type>)
+    {
+        this->reserve(values.size());
+        for (auto const& value : values)
+            this->insert(value);
+    }
+
+    // Constructs the value from `args` unless the `key` is in the map already. Returns an iterator
+    // to the value with the `key` and whether it has been constructed.
+    template <typename... Args>
+        requires(meta::copy_constructible<Key> and meta::nothrow_constructible<T, Args...>)
+    ::std::pair<iterator, bool> try_emplace(key_type const& key, Args&&... args) noexcept {
+        return try_emplace_key(key, ::std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+        requires(meta::nothrow_constructible<T, Args...>)
+    ::std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) noexcept {
+        return try_emplace_key(::std::move(key), ::std::forward<Args>(args)...);
+    }
+
+    // Assigns the `value` to the `key`, or inserts it if the `key` is not in the map yet.
+    template <typename Value>
+        requires(meta::copy_constructible<Key> and meta::nothrow_constructible<T, Value&&>)
+    ::std::pair<iterator, bool> insert_or_assign(key_type const& key, Value&& value) noexcept {
+        auto result = try_emplace_key(key, ::std::forward<Value>(value));
+        if (!result.second)
+            result.first->second = ::std::forward<Value>(value);
+        return result;
+    }
+
+    // Returns the value of the `key`, which is value-initialized if it is not in the map yet.
+    T& operator[](key_type const& key) noexcept
+        requires(meta::copy_constructible<Key> and meta::default_initializable<T>)
+    {
+        return try_emplace_key(key).first->second;
+    }
+
+    T& operator[](key_type&& key) noexcept
+        requires meta::default_initializable<T>
+    {
+        return try_emplace_key(::std::move(key)).first->second;
+    }
+
+private:
+    template <typename K, typename... Args>
+    ::std::pair<iterator, bool> try_emplace_key(K&& key, Args&&... args) noexcept {
+        auto const [index, inserted] = this->find_or_prepare_insert(key);
+        if (inserted) {
+            ::std::construct_at(detail::hash_map_policy<Key, T>::element(this->slots() + index),
+                                ::std::piecewise_construct,
+                                ::std::forward_as_tuple(::std::forward<K>(key)),
+                                ::std::forward_as_tuple(::std::forward<Args>(args)...));
+        }
+        return {this->iterator_at(index), inserted};
+    }
+};
+
+} // namespace flux::fou
@@ -0,0 +1,50 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <string_view>
+
+using namespace flux;
+using namespace flux::fou;
+
+namespace {
+
+struct [[nodiscard]] string_hash final {
+    using is_transparent = void;
+
+    ::std::size_t operator()(::std::string_view string) const noexcept {
+        return ::std::hash<::std::string_view>{}(string);
+    }
+};
+
+} // namespace
+
+TEST_CASE("fou::flat_hash_set", "[flux-containers/flat_hash_set.hpp]") {
+    flat_hash_set<int> set;
+    for (int i = 0; i < 500; ++i)
+        CHECK(set.insert(i * 7).second);
+    CHECK(!set.insert(0).second);
+    CHECK(set.size() == 500u);
+    for (int i = 0; i < 500; ++i) {
+        CHECK(set.contains(i * 7));
+        CHECK(!set.contains(i * 7 + 1));
+    }
+
+    for (int i = 0; i < 500; i += 2)
+        set.erase(i * 7);
+    CHECK(set.size() == 250u);
+    ::std::size_t count = 0u;
+    for (auto const key : set) {
+        CHECK(key % 14 == 7);
+        ++count;
+    }
+    CHECK(count == 250u);
+
+    flat_hash_set<::std::string, string_hash, ::std::equal_to<>> strings{"a", "b", "c"};
+    CHECK(strings.size() == 3u);
+    CHECK(strings.contains(::std::string_view{"b"}));
+    CHECK(*strings.find("c") == "c");
+    CHECK(strings.emplace(::std::string{"ddd"}).second);
+    CHECK(strings.contains("ddd"));
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <flux/foundation/containers/detail/raw_hash_table.hpp>
+
+#include <functional>
+
+namespace flux::fou {
+
+namespace detail {
+
+template <typename Key>
+struct [[nodiscard]] hash_set_policy final {
+    using key_type   = Key;
+    using value_type = Key;
+    using slot_type  = Key;
+
+    static Key const& key(value_type const& value) noexcept {
+        return value;
+    }
+
+    static value_type* element(slot_type* slot) noexcept {
+        return slot;
+    }
+
+    static void relocate(slot_type* src, slot_type* dest) noexcept {
+        relocate_at(src, dest);
+    }
+};
+
+} // namespace detail
+
+// A set of unique keys in an open-addressing hash table, see `detail::raw_hash_table`. Unlike
+// `std::unordered_set` there is no allocation per key, the keys are stored in the table itself.
+// NOTE:
+//  Inserting invalidates iterators and references if the table grows.
+template <meta::nothrow_move_constructible Key, typename Hash = ::std::hash<Key>,
+          typename KeyEqual = ::std::equal_to<Key>, raw_allocator RawAllocator = default_allocator>
+    requires meta::nothrow_destructible<Key>
+class [[nodiscard]] flat_hash_set
+        : public detail::raw_hash_table<detail::hash_set_policy<Key>, Hash, KeyEqual, RawAllocator> {
+    using base = detail::raw_hash_table<detail::hash_set_policy<Key>, Hash, KeyEqual, RawAllocator>;
+
+public:
+    using base::base;
+
+    flat_hash_set() noexcept = default;
+
+    flat_hash_set(::std::initializer_list<Key> keys) noexcept
+        requires(not is_stateful_allocator<typename base::allocator_type>::value and
+                 meta::copy_constructible<Key>)
+    {
+        this->reserve(keys.size());
+        for (auto const& key : keys)
+            this->insert(key);
+    }
+};
+
+} // namespace flux::fou
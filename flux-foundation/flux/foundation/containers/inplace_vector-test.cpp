@@ -0,0 +1,120 @@
+#include <flux/foundation.hpp>
+#include <flux/foundation/containers/detail/test_types.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+
+using namespace flux;
+using namespace flux::fou;
+
+static_assert(sizeof(inplace_vector<char, 7>) == 8u);
+static_assert(meta::trivially_copyable<inplace_vector<int, 4>>);
+static_assert(not meta::trivially_copyable<inplace_vector<::std::string, 4>>);
+static_assert(meta::trivially_relocatable<inplace_vector<owner, 4>>);
+static_assert(not meta::trivially_relocatable<inplace_vector<self_aware, 4>>);
+
+TEST_CASE("fou::inplace_vector", "[flux-containers/inplace_vector.hpp]") {
+    inplace_vector<int, 8> vector;
+    CHECK(vector.empty());
+    CHECK(vector.capacity() == 8u);
+
+    for (int i = 0; i < 8; ++i)
+        vector.push_back(i);
+    CHECK(vector.full());
+    CHECK(vector.front() == 0);
+    CHECK(vector.back() == 7);
+
+    SECTION("try_push_back") {
+        CHECK(vector.try_push_back(8) == nullptr);
+        CHECK(vector.size() == 8u);
+        vector.pop_back();
+        auto* value = vector.try_emplace_back(8);
+        REQUIRE(value);
+        CHECK(*value == 8);
+        CHECK(value == &vector.back());
+    }
+    SECTION("resize") {
+        vector.resize(3u);
+        CHECK(vector.size() == 3u);
+        CHECK(vector.back() == 2);
+        vector.resize(5u, 7);
+        CHECK(vector[4u] == 7);
+        vector.resize(6u);
+        CHECK(vector[5u] == 0);
+    }
+    SECTION("insert and erase") {
+        vector.resize(5u);
+        int const values[] = {-1, -2};
+        auto      it       = vector.insert(vector.begin() + 2, values, values + 2);
+        CHECK(it == vector.begin() + 2);
+        CHECK(vector.size() == 7u);
+        CHECK(vector[1u] == 1);
+        CHECK(vector[2u] == -1);
+        CHECK(vector[4u] == 2);
+
+        it = vector.erase(vector.begin() + 2, vector.begin() + 4);
+        CHECK(*it == 2);
+        for (int i = 0; i < 5; ++i)
+            CHECK(vector[static_cast<::std::size_t>(i)] == i);
+
+        vector.emplace(vector.begin(), vector.back());
+        CHECK(vector.front() == 4);
+    }
+    SECTION("copy and move") {
+        auto copy = vector;
+        CHECK(copy.size() == 8u);
+        CHECK(copy.back() == 7);
+
+        copy = inplace_vector<int, 8>{1, 2, 3};
+        CHECK(copy.size() == 3u);
+        CHECK(copy[2u] == 3);
+    }
+}
+
+TEST_CASE("fou::inplace_vector non-trivial values", "[flux-containers/inplace_vector.hpp]") {
+    SECTION("trivially relocatable") {
+        inplace_vector<owner, 8> vector;
+        for (int i = 0; i < 6; ++i)
+            vector.emplace_back(i);
+        vector.emplace(vector.begin() + 3, -1);
+        CHECK(*vector[3u].value == -1);
+        CHECK(*vector[4u].value == 3);
+        vector.erase(vector.begin() + 3);
+        for (int i = 0; i < 6; ++i)
+            CHECK(*vector[static_cast<::std::size_t>(i)].value == i);
+
+        auto moved = ::std::move(vector);
+        CHECK(moved.size() == 6u);
+        CHECK(*moved.back().value == 5);
+    }
+    SECTION("not trivially relocatable") {
+        inplace_vector<self_aware, 8> vector;
+        for (int i = 0; i < 6; ++i)
+            vector.emplace_back(i);
+
+        vector.insert(vector.begin() + 3, self_aware{-1});
+        CHECK(is_valid(vector));
+        CHECK(vector[3u].value == -1);
+        CHECK(vector[4u].value == 3);
+
+        vector.erase(vector.begin() + 3);
+        CHECK(is_valid(vector));
+
+        auto copy = vector;
+        CHECK(is_valid(copy));
+        CHECK(copy.size() == 6u);
+        CHECK(copy.back().value == 5);
+    }
+    SECTION("strings") {
+        inplace_vector<::std::string, 4> vector{"a", "b", "c"};
+        vector.insert(vector.begin() + 1, ::std::string(32u, 'x'));
+        CHECK(vector[1u] == ::std::string(32u, 'x'));
+        CHECK(vector[2u] == "b");
+
+        auto copy = vector;
+        copy = vector;
+        CHECK(copy.size() == 4u);
+        CHECK(copy.back() == "c");
+    }
+}
@@ -0,0 +1,375 @@
+#pragma once
+#include <flux/foundation/containers/detail/gap.hpp>
+#include <flux/foundation/memory/uninitialized_algorithms.hpp>
+#include <flux/foundation/memory/uninitialized_storage.hpp>
+
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+
+namespace flux::fou {
+
+namespace detail {
+
+// The smallest unsigned integer that can count up to `N`.
+template <::std::size_t N>
+using inplace_size_t = meta::condition<
+        (N <= UINT8_MAX), ::std::uint8_t,
+        meta::condition<(N <= UINT16_MAX), ::std::uint16_t,
+                        meta::condition<(N <= UINT32_MAX), ::std::uint32_t, ::std::size_t>>>;
+
+} // namespace detail
+
+// A contiguous array of up to `N` values of `T` that are stored in the object itself, after the
+// `std::inplace_vector` of C++26. The values are constructed in `uninitialized_storage` and the
+// size is stored in the smallest integer that fits `N`, so it never allocates.
+// It is trivially copyable if `T` is and trivially relocatable if `T` is.
+// NOTE:
+//  Growing beyond `N` terminates, the `try_` functions return `nullptr` instead and the
+//  `unchecked_` functions leave it to the caller. `N` must not be zero.
+template <meta::nothrow_move_constructible T, ::std::size_t N>
+    requires(meta::nothrow_destructible<T> and N > 0u)
+class [[nodiscard]] inplace_vector {
+    using stored_size_type = detail::inplace_size_t<N>;
+
+public:
+    using value_type      = T;
+    using size_type       = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+    using reference       = T&;
+    using const_reference = T const&;
+    using pointer         = T*;
+    using const_pointer   = T const*;
+    using iterator        = T*;
+    using const_iterator  = T const*;
+
+    using trivially_relocatable = meta::bool_constant<meta::trivially_relocatable<T>>;
+
+    inplace_vector() noexcept = default;
+
+    // Constructs `count` value-initialized values.
+    explicit inplace_vector(size_type count) noexcept
+        requires meta::default_initializable<T>
+    {
+        resize(count);
+    }
+
+    inplace_vector(size_type count, T const& value) noexcept
+        requires meta::copy_constructible<T>
+    {
+        resize(count, value);
+    }
+
+    inplace_vector(::std::initializer_list<T> values) noexcept
+        requires meta::copy_constructible<T>
+    {
+        insert(end(), values.begin(), values.end());
+    }
+
+    // clang-format off
+    inplace_vector(inplace_vector const&) noexcept
+        requires meta::trivially_copy_constructible<T>
+    = default;
+    inplace_vector(inplace_vector const& other) noexcept
+        requires(meta::copy_constructible<T> and not meta::trivially_copy_constructible<T>)
+            : size_{other.size_} {
+        ranges::uninitialized_copy_no_overlap(other.begin(), other.end(), data());
+    }
+
+    // The values of the `other` vector are left moved-from.
+    inplace_vector(inplace_vector&&) noexcept
+        requires meta::trivially_move_constructible<T>
+    = default;
+    inplace_vector(inplace_vector&& other) noexcept
+            : size_{other.size_} {
+        ranges::uninitialized_move(other.begin(), other.end(), data());
+    }
+
+    inplace_vector& operator=(inplace_vector const&) noexcept
+        requires(meta::copy_constructible<T> and meta::trivially_copy_constructible<T> and
+                 meta::trivially_copy_assignable<T> and meta::trivially_destructible<T>)
+    = default;
+    inplace_vector& operator=(inplace_vector const& other) noexcept
+        requires meta::copy_constructible<T>
+    {
+        if (this != &other) {
+            clear();
+            ranges::uninitialized_copy_no_overlap(other.begin(), other.end(), data());
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    inplace_vector& operator=(inplace_vector&&) noexcept
+        requires(meta::trivially_move_constructible<T> and meta::trivially_move_assignable<T> and
+                 meta::trivially_destructible<T>)
+    = default;
+    inplace_vector& operator=(inplace_vector&& other) noexcept {
+        if (this != &other) {
+            clear();
+            ranges::uninitialized_move(other.begin(), other.end(), data());
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    ~inplace_vector() requires meta::trivially_destructible<T> = default;
+    ~inplace_vector() {
+        clear();
+    }
+    // clang-format on
+
+    iterator begin() noexcept {
+        return data();
+    }
+    const_iterator begin() const noexcept {
+        return data();
+    }
+
+    iterator end() noexcept {
+        return data() + size_;
+    }
+    const_iterator end() const noexcept {
+        return data() + size_;
+    }
+
+    T& operator[](size_type index) noexcept {
+        FLUX_ASSERT(index < size_);
+        return data()[index];
+    }
+    T const& operator[](size_type index) const noexcept {
+        FLUX_ASSERT(index < size_);
+        return data()[index];
+    }
+
+    T& front() noexcept {
+        return (*this)[0u];
+    }
+    T const& front() const noexcept {
+        return (*this)[0u];
+    }
+
+    T& back() noexcept {
+        return (*this)[size_ - 1u];
+    }
+    T const& back() const noexcept {
+        return (*this)[size_ - 1u];
+    }
+
+    T* data() noexcept {
+        return storage_[0].data();
+    }
+    T const* data() const noexcept {
+        return storage_[0].data();
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0u;
+    }
+
+    bool full() const noexcept {
+        return size_ == N;
+    }
+
+    static constexpr size_type capacity() noexcept {
+        return N;
+    }
+
+    static constexpr size_type max_size() noexcept {
+        return N;
+    }
+
+    // There is nothing to reserve, `count` must not exceed the capacity.
+    static void reserve(size_type count) noexcept {
+        if (count > N) [[unlikely]]
+            fast_terminate();
+    }
+
+    static void shrink_to_fit() noexcept {}
+
+    void clear() noexcept {
+        ::std::destroy(begin(), end());
+        size_ = 0u;
+    }
+
+    // Value-initializes new values or destroys those beyond `count`.
+    void resize(size_type count) noexcept
+        requires meta::default_initializable<T>
+    {
+        reserve(count);
+        if (count > size_)
+            ranges::uninitialized_value_construct_n(end(),
+                                                    static_cast<difference_type>(count - size_));
+        else
+            ::std::destroy(begin() + count, end());
+        size_ = static_cast<stored_size_type>(count);
+    }
+
+    void resize(size_type count, T const& value) noexcept
+        requires meta::copy_constructible<T>
+    {
+        reserve(count);
+        if (count > size_)
+            ::std::uninitialized_fill(end(), begin() + count, value);
+        else
+            ::std::destroy(begin() + count, end());
+        size_ = static_cast<stored_size_type>(count);
+    }
+
+    // Constructs a value at the back, terminates if the vector is full.
+    template <typename... Args>
+        requires meta::nothrow_constructible<T, Args...>
+    T& emplace_back(Args&&... args) noexcept {
+        if (full()) [[unlikely]]
+            fast_terminate();
+        return unchecked_emplace_back(::std::forward<Args>(args)...);
+    }
+
+    void push_back(T const& value) noexcept
+        requires meta::copy_constructible<T>
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) noexcept {
+        emplace_back(::std::move(value));
+    }
+
+    // Constructs a value at the back, returns `nullptr` if the vector is full.
+    template <typename... Args>
+        requires meta::nothrow_constructible<T, Args...>
+    T* try_emplace_back(Args&&... args) noexcept {
+        if (full())
+            return nullptr;
+        return fou::addressof(unchecked_emplace_back(::std::forward<Args>(args)...));
+    }
+
+    T* try_push_back(T const& value) noexcept
+        requires meta::copy_constructible<T>
+    {
+        return try_emplace_back(value);
+    }
+
+    T* try_push_back(T&& value) noexcept {
+        return try_emplace_back(::std::move(value));
+    }
+
+    // Constructs a value at the back, the vector must not be full.
+    template <typename... Args>
+        requires meta::nothrow_constructible<T, Args...>
+    T& unchecked_emplace_back(Args&&... args) noexcept {
+        FLUX_ASSERT(!full());
+        auto* value = ::std::construct_at(end(), ::std::forward<Args>(args)...);
+        ++size_;
+        return *value;
+    }
+
+    T& unchecked_push_back(T const& value) noexcept
+        requires meta::copy_constructible<T>
+    {
+        return unchecked_emplace_back(value);
+    }
+
+    T& unchecked_push_back(T&& value) noexcept {
+        return unchecked_emplace_back(::std::move(value));
+    }
+
+    void pop_back() noexcept {
+        FLUX_ASSERT(!empty());
+        ::std::destroy_at(data() + --size_);
+    }
+
+    // Constructs a value before `position` and returns an iterator to it, terminates if the
+    // vector is full.
+    template <typename... Args>
+        requires meta::nothrow_constructible<T, Args...>
+    iterator emplace(const_iterator position, Args&&... args) noexcept {
+        auto const index = static_cast<size_type>(position - begin());
+        FLUX_ASSERT(index <= size_);
+        if (index == size_) {
+            emplace_back(::std::forward<Args>(args)...);
+            return begin() + index;
+        }
+
+        // The `args` may refer to our values, which are about to move.
+        T    value(::std::forward<Args>(args)...);
+        auto gap = open_gap(index, 1u);
+        ::std::construct_at(gap, ::std::move(value));
+        ++size_;
+        return gap;
+    }
+
+    iterator insert(const_iterator position, T const& value) noexcept
+        requires meta::copy_constructible<T>
+    {
+        return emplace(position, value);
+    }
+
+    iterator insert(const_iterator position, T&& value) noexcept {
+        return emplace(position, ::std::move(value));
+    }
+
+    // Copies the values of `[first, last)` before `position` and returns an iterator to the first
+    // of them, terminates if they don't fit.
+    // NOTE:
+    //  The values must not be part of this vector.
+    template <meta::forward_iterator Iterator, meta::sentinel_for<Iterator> Sentinel>
+        requires meta::constructible_from<T, meta::iter_ref_t<Iterator>>
+    iterator insert(const_iterator position, Iterator first, Sentinel last) noexcept {
+        auto const index = static_cast<size_type>(position - begin());
+        auto const count = static_cast<size_type>(::std::ranges::distance(first, last));
+        FLUX_ASSERT(index <= size_);
+        if (count == 0u)
+            return begin() + index;
+
+        auto gap = open_gap(index, count);
+        ranges::uninitialized_copy_no_overlap(::std::move(first), ::std::move(last), gap);
+        size_ = static_cast<stored_size_type>(size_ + count);
+        return gap;
+    }
+
+    iterator insert(const_iterator position, ::std::initializer_list<T> values) noexcept
+        requires meta::copy_constructible<T>
+    {
+        return insert(position, values.begin(), values.end());
+    }
+
+    iterator erase(const_iterator position) noexcept {
+        return erase(position, position + 1);
+    }
+
+    // Destroys the values of `[first, last)` and closes the gap, returns an iterator to the value
+    // that followed them.
+    iterator erase(const_iterator first, const_iterator last) noexcept {
+        auto const index = static_cast<size_type>(first - begin());
+        auto const count = static_cast<size_type>(last - first);
+        FLUX_ASSERT(index + count <= size_);
+
+        auto* const gap = begin() + index;
+        detail::close_gap(gap, end(), count);
+        size_ = static_cast<stored_size_type>(size_ - count);
+        return gap;
+    }
+
+private:
+    // Makes room for `count` uninitialized values in front of the one at `index`, and returns the
+    // first of them. The size is left unchanged.
+    T* open_gap(size_type index, size_type count) noexcept {
+        if (size_ + count > N) [[unlikely]]
+            fast_terminate();
+
+        auto* const gap = data() + index;
+        detail::open_gap(gap, end(), count);
+        return gap;
+    }
+
+    uninitialized_storage<T> storage_[N];
+    stored_size_type         size_ = 0u;
+};
+
+} // namespace flux::fou
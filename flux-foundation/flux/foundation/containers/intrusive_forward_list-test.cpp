@@ -0,0 +1,70 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+using namespace flux;
+using namespace flux::fou;
+
+namespace {
+
+struct [[nodiscard]] item final : forward_list_hook {
+    explicit item(int v) noexcept : value{v} {}
+
+    int value;
+};
+
+template <typename List>
+::std::vector<int> values(List const& list) {
+    ::std::vector<int> result;
+    for (auto const& element : list)
+        result.push_back(element.value);
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("fou::intrusive_forward_list", "[flux-containers/intrusive_forward_list.hpp]") {
+    intrusive_forward_list<item> list{16u};
+    CHECK(list.empty());
+    CHECK(list.begin() == list.end());
+
+    list.emplace_front(3);
+    list.emplace_front(1);
+    auto it = list.emplace_after(list.begin(), 2);
+    CHECK(it->value == 2);
+    CHECK(list.size() == 3u);
+    CHECK(list.front().value == 1);
+    CHECK(values(list) == ::std::vector<int>{1, 2, 3});
+
+    SECTION("erase") {
+        it = list.erase_after(list.iterator_to(list.front()));
+        CHECK(it->value == 3);
+        CHECK(values(list) == ::std::vector<int>{1, 3});
+
+        list.pop_front();
+        CHECK(values(list) == ::std::vector<int>{3});
+        list.pop_front();
+        CHECK(list.empty());
+    }
+    SECTION("clear") {
+        for (int i = 0; i < 100; ++i)
+            list.emplace_front(i);
+        CHECK(list.size() == 103u);
+
+        list.clear();
+        CHECK(list.empty());
+        CHECK(list.begin() == list.end());
+
+        list.emplace_front(7);
+        CHECK(values(list) == ::std::vector<int>{7});
+    }
+    SECTION("move") {
+        auto moved = ::std::move(list);
+        CHECK(list.empty());
+        CHECK(values(moved) == ::std::vector<int>{1, 2, 3});
+        moved.emplace_front(0);
+        CHECK(moved.size() == 4u);
+    }
+}
@@ -0,0 +1,225 @@
+#pragma once
+#include <flux/foundation/containers/detail/intrusive_node_pool.hpp>
+
+#include <iterator>
+
+namespace flux::fou {
+
+// The link of a value of an `intrusive_forward_list`, whose value type derives from it.
+// NOTE:
+//  Copying a value does not copy its link.
+class [[nodiscard]] forward_list_hook {
+public:
+    forward_list_hook() noexcept = default;
+    forward_list_hook(forward_list_hook const&) noexcept {}
+    forward_list_hook& operator=(forward_list_hook const&) noexcept {
+        return *this;
+    }
+
+private:
+    struct links {
+        forward_list_hook* next = nullptr;
+    };
+
+    links links_;
+
+    friend detail::hook_access;
+};
+
+namespace detail {
+
+template <typename Value>
+class forward_list_iterator {
+public:
+    using value_type        = meta::remove_cv_t<Value>;
+    using difference_type   = ::std::ptrdiff_t;
+    using reference         = Value&;
+    using pointer           = Value*;
+    using iterator_category = ::std::forward_iterator_tag;
+
+    forward_list_iterator() noexcept = default;
+
+    explicit forward_list_iterator(forward_list_hook* hook) noexcept : hook_{hook} {}
+
+    operator forward_list_iterator<Value const>() const noexcept
+        requires(not ::std::is_const_v<Value>)
+    {
+        return forward_list_iterator<Value const>{hook_};
+    }
+
+    Value& operator*() const noexcept {
+        return static_cast<value_type&>(*hook_);
+    }
+
+    Value* operator->() const noexcept {
+        return fou::addressof(**this);
+    }
+
+    forward_list_iterator& operator++() noexcept {
+        hook_ = hook_access::links(*hook_).next;
+        return *this;
+    }
+
+    forward_list_iterator operator++(int) noexcept {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    bool operator==(forward_list_iterator const&) const noexcept = default;
+
+private:
+    forward_list_hook* hook_ = nullptr;
+
+    friend hook_access;
+};
+
+} // namespace detail
+
+// A singly linked list of values that derive from `forward_list_hook`. The values are constructed
+// in a `memory_pool` of nodes of their size, so inserting only allocates when the pool grows and
+// `clear()` returns all nodes at once by resetting it.
+// NOTE:
+//  It owns its pool, so it can be moved but not assigned.
+template <typename T, typename BlockOrRawAllocator = default_allocator>
+    requires(meta::derived_from<T, forward_list_hook> and meta::nothrow_destructible<T>)
+class [[nodiscard]] intrusive_forward_list {
+    using nodes_type  = detail::intrusive_node_pool<T, BlockOrRawAllocator>;
+    using hook_access = detail::hook_access;
+
+public:
+    using value_type      = T;
+    using size_type       = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+    using reference       = T&;
+    using const_reference = T const&;
+    using iterator        = detail::forward_list_iterator<T>;
+    using const_iterator  = detail::forward_list_iterator<T const>;
+
+    intrusive_forward_list() noexcept
+            : intrusive_forward_list{nodes_type::default_nodes_per_block} {}
+
+    // The pool allocates blocks of `nodes_per_block` values, the `args` are forwarded to its
+    // block allocator.
+    template <typename... Args>
+    explicit intrusive_forward_list(size_type nodes_per_block, Args&&... args) noexcept
+            : nodes_{nodes_per_block, ::std::forward<Args>(args)...} {}
+
+    intrusive_forward_list(intrusive_forward_list&& other) noexcept
+            : nodes_{::std::move(other.nodes_)}, size_{::std::exchange(other.size_, 0u)} {
+        next(&head_) = ::std::exchange(next(&other.head_), nullptr);
+    }
+
+    ~intrusive_forward_list() {
+        destroy_values();
+    }
+
+    iterator before_begin() noexcept {
+        return iterator{&head_};
+    }
+    const_iterator before_begin() const noexcept {
+        return const_iterator{const_cast<forward_list_hook*>(&head_)};
+    }
+
+    iterator begin() noexcept {
+        return iterator{next(&head_)};
+    }
+    const_iterator begin() const noexcept {
+        return const_iterator{hook_access::links(head_).next};
+    }
+
+    iterator end() noexcept {
+        return iterator{};
+    }
+    const_iterator end() const noexcept {
+        return const_iterator{};
+    }
+
+    // Returns an iterator to the `value`, which must be in this list.
+    iterator iterator_to(T& value) noexcept {
+        return iterator{&value};
+    }
+    const_iterator iterator_to(T const& value) const noexcept {
+        return const_iterator{const_cast<T*>(&value)};
+    }
+
+    T& front() noexcept {
+        FLUX_ASSERT(!empty());
+        return *begin();
+    }
+    T const& front() const noexcept {
+        FLUX_ASSERT(!empty());
+        return *begin();
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0u;
+    }
+
+    template <typename... Args>
+        requires meta::nothrow_constructible<T, Args...>
+    T& emplace_front(Args&&... args) noexcept {
+        return *emplace_after(before_begin(), ::std::forward<Args>(args)...);
+    }
+
+    // Constructs a value after `position` and returns an iterator to it.
+    template <typename... Args>
+        requires meta::nothrow_constructible<T, Args...>
+    iterator emplace_after(const_iterator position, Args&&... args) noexcept {
+        auto* const previous = hook_access::hook(position);
+        auto* const value    = nodes_.create(::std::forward<Args>(args)...);
+        next(value)    = next(previous);
+        next(previous) = value;
+        ++size_;
+        return iterator{value};
+    }
+
+    void pop_front() noexcept {
+        FLUX_ASSERT(!empty());
+        erase_after(before_begin());
+    }
+
+    // Destroys the value after `position` and returns an iterator to the one that followed it.
+    iterator erase_after(const_iterator position) noexcept {
+        auto* const previous = hook_access::hook(position);
+        auto* const erased   = next(previous);
+        FLUX_ASSERT(erased);
+        next(previous) = next(erased);
+        nodes_.destroy(static_cast<T*>(erased));
+        --size_;
+        return iterator{next(previous)};
+    }
+
+    // Destroys all values and resets the pool, which keeps its first block.
+    void clear() noexcept {
+        destroy_values();
+        nodes_.reset();
+        next(&head_) = nullptr;
+        size_        = 0u;
+    }
+
+private:
+    static forward_list_hook*& next(forward_list_hook* hook) noexcept {
+        return hook_access::links(*hook).next;
+    }
+
+    void destroy_values() noexcept {
+        if constexpr (not meta::trivially_destructible<T>) {
+            for (auto* hook = next(&head_); hook;) {
+                auto* const following = next(hook);
+                ::std::destroy_at(static_cast<T*>(hook));
+                hook = following;
+            }
+        }
+    }
+
+    nodes_type        nodes_;
+    forward_list_hook head_;
+    size_type         size_ = 0u;
+};
+
+} // namespace flux::fou
@@ -0,0 +1,88 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace flux;
+using namespace flux::fou;
+
+namespace {
+
+int destroyed = 0;
+
+struct [[nodiscard]] item final : list_hook {
+    explicit item(int v) noexcept : value{v}, name(32u, 'x') {}
+    ~item() {
+        ++destroyed;
+    }
+
+    int           value;
+    ::std::string name;
+};
+
+template <typename List>
+::std::vector<int> values(List const& list) {
+    ::std::vector<int> result;
+    for (auto const& element : list)
+        result.push_back(element.value);
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("fou::intrusive_list", "[flux-containers/intrusive_list.hpp]") {
+    destroyed = 0;
+    {
+        intrusive_list<item> list{16u};
+        CHECK(list.empty());
+        CHECK(list.begin() == list.end());
+
+        list.emplace_back(2);
+        list.emplace_front(1);
+        auto& last = list.emplace_back(4);
+        list.emplace(list.iterator_to(last), 3);
+        CHECK(list.size() == 4u);
+        CHECK(list.front().value == 1);
+        CHECK(list.back().value == 4);
+        CHECK(values(list) == ::std::vector<int>{1, 2, 3, 4});
+        CHECK((--list.end())->value == 4);
+
+        SECTION("erase") {
+            auto it = list.erase(++list.begin());
+            CHECK(it->value == 3);
+            list.erase(last);
+            CHECK(values(list) == ::std::vector<int>{1, 3});
+            CHECK(destroyed == 2);
+
+            list.pop_back();
+            list.pop_front();
+            CHECK(list.empty());
+            CHECK(destroyed == 4);
+        }
+        SECTION("clear") {
+            for (int i = 0; i < 100; ++i)
+                list.emplace_back(i);
+            CHECK(list.size() == 104u);
+
+            list.clear();
+            CHECK(destroyed == 104);
+            CHECK(list.empty());
+            CHECK(list.begin() == list.end());
+
+            list.emplace_back(7);
+            CHECK(values(list) == ::std::vector<int>{7});
+        }
+        SECTION("move") {
+            auto moved = ::std::move(list);
+            CHECK(list.empty());
+            CHECK(list.begin() == list.end());
+            CHECK(values(moved) == ::std::vector<int>{1, 2, 3, 4});
+            moved.emplace_front(0);
+            moved.pop_back();
+            CHECK(values(moved) == ::std::vector<int>{0, 1, 2, 3});
+        }
+    }
+    CHECK(destroyed >= 4);
+}
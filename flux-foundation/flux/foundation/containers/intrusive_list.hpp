@@ -0,0 +1,278 @@
+#pragma once
+#include <flux/foundation/containers/detail/intrusive_node_pool.hpp>
+
+#include <iterator>
+
+namespace flux::fou {
+
+// The links of a value of an `intrusive_list`, whose value type derives from it.
+// NOTE:
+//  Copying a value does not copy its links.
+class [[nodiscard]] list_hook {
+public:
+    list_hook() noexcept = default;
+    list_hook(list_hook const&) noexcept {}
+    list_hook& operator=(list_hook const&) noexcept {
+        return *this;
+    }
+
+private:
+    struct links {
+        list_hook* prev = nullptr;
+        list_hook* next = nullptr;
+    };
+
+    links links_;
+
+    friend detail::hook_access;
+};
+
+namespace detail {
+
+template <typename Value>
+class list_iterator {
+public:
+    using value_type        = meta::remove_cv_t<Value>;
+    using difference_type   = ::std::ptrdiff_t;
+    using reference         = Value&;
+    using pointer           = Value*;
+    using iterator_category = ::std::bidirectional_iterator_tag;
+
+    list_iterator() noexcept = default;
+
+    explicit list_iterator(list_hook* hook) noexcept : hook_{hook} {}
+
+    operator list_iterator<Value const>() const noexcept
+        requires(not ::std::is_const_v<Value>)
+    {
+        return list_iterator<Value const>{hook_};
+    }
+
+    Value& operator*() const noexcept {
+        return static_cast<value_type&>(*hook_);
+    }
+
+    Value* operator->() const noexcept {
+        return fou::addressof(**this);
+    }
+
+    list_iterator& operator++() noexcept {
+        hook_ = hook_access::links(*hook_).next;
+        return *this;
+    }
+
+    list_iterator operator++(int) noexcept {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    list_iterator& operator--() noexcept {
+        hook_ = hook_access::links(*hook_).prev;
+        return *this;
+    }
+
+    list_iterator operator--(int) noexcept {
+        auto copy = *this;
+        --*this;
+        return copy;
+    }
+
+    bool operator==(list_iterator const&) const noexcept = default;
+
+private:
+    list_hook* hook_ = nullptr;
+
+    friend hook_access;
+};
+
+} // namespace detail
+
+// A doubly linked list of values that derive from `list_hook`. The values are constructed in a
+// `memory_pool` of nodes of their size, so inserting only allocates when the pool grows and
+// `clear()` returns all nodes at once by resetting it. A value can be erased in constant time
+// through a reference to it.
+// NOTE:
+//  It owns its pool, so it can be moved but not assigned.
+template <typename T, typename BlockOrRawAllocator = default_allocator>
+    requires(meta::derived_from<T, list_hook> and meta::nothrow_destructible<T>)
+class [[nodiscard]] intrusive_list {
+    using nodes_type  = detail::intrusive_node_pool<T, BlockOrRawAllocator>;
+    using hook_access = detail::hook_access;
+
+public:
+    using value_type      = T;
+    using size_type       = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+    using reference       = T&;
+    using const_reference = T const&;
+    using iterator        = detail::list_iterator<T>;
+    using const_iterator  = detail::list_iterator<T const>;
+
+    intrusive_list() noexcept : intrusive_list{nodes_type::default_nodes_per_block} {}
+
+    // The pool allocates blocks of `nodes_per_block` values, the `args` are forwarded to its
+    // block allocator.
+    template <typename... Args>
+    explicit intrusive_list(size_type nodes_per_block, Args&&... args) noexcept
+            : nodes_{nodes_per_block, ::std::forward<Args>(args)...} {
+        link_root();
+    }
+
+    intrusive_list(intrusive_list&& other) noexcept
+            : nodes_{::std::move(other.nodes_)}, size_{::std::exchange(other.size_, 0u)} {
+        if (size_ == 0u) {
+            link_root();
+        } else {
+            // The first and the last value point to the root, which has moved.
+            prev(&root_)       = prev(&other.root_);
+            next(&root_)       = next(&other.root_);
+            next(prev(&root_)) = &root_;
+            prev(next(&root_)) = &root_;
+            other.link_root();
+        }
+    }
+
+    ~intrusive_list() {
+        destroy_values();
+    }
+
+    iterator begin() noexcept {
+        return iterator{next(&root_)};
+    }
+    const_iterator begin() const noexcept {
+        return const_iterator{hook_access::links(root_).next};
+    }
+
+    iterator end() noexcept {
+        return iterator{&root_};
+    }
+    const_iterator end() const noexcept {
+        return const_iterator{const_cast<list_hook*>(&root_)};
+    }
+
+    // Returns an iterator to the `value`, which must be in this list.
+    iterator iterator_to(T& value) noexcept {
+        return iterator{&value};
+    }
+    const_iterator iterator_to(T const& value) const noexcept {
+        return const_iterator{const_cast<T*>(&value)};
+    }
+
+    T& front() noexcept {
+        FLUX_ASSERT(!empty());
+        return *begin();
+    }
+    T const& front() const noexcept {
+        FLUX_ASSERT(!empty());
+        return *begin();
+    }
+
+    T& back() noexcept {
+        FLUX_ASSERT(!empty());
+        return *--end();
+    }
+    T const& back() const noexcept {
+        FLUX_ASSERT(!empty());
+        return *--end();
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0u;
+    }
+
+    template <typename... Args>
+        requires meta::nothrow_constructible<T, Args...>
+    T& emplace_front(Args&&... args) noexcept {
+        return *emplace(begin(), ::std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+        requires meta::nothrow_constructible<T, Args...>
+    T& emplace_back(Args&&... args) noexcept {
+        return *emplace(end(), ::std::forward<Args>(args)...);
+    }
+
+    // Constructs a value before `position` and returns an iterator to it.
+    template <typename... Args>
+        requires meta::nothrow_constructible<T, Args...>
+    iterator emplace(const_iterator position, Args&&... args) noexcept {
+        auto* const following = hook_access::hook(position);
+        auto* const value     = nodes_.create(::std::forward<Args>(args)...);
+        prev(value)           = prev(following);
+        next(value)           = following;
+        next(prev(following)) = value;
+        prev(following)       = value;
+        ++size_;
+        return iterator{value};
+    }
+
+    void pop_front() noexcept {
+        FLUX_ASSERT(!empty());
+        erase(begin());
+    }
+
+    void pop_back() noexcept {
+        FLUX_ASSERT(!empty());
+        erase(--end());
+    }
+
+    // Destroys the value at `position` and returns an iterator to the one that followed it.
+    iterator erase(const_iterator position) noexcept {
+        auto* const erased    = hook_access::hook(position);
+        auto* const following = next(erased);
+        FLUX_ASSERT(erased != &root_);
+        next(prev(erased)) = following;
+        prev(following)    = prev(erased);
+        nodes_.destroy(static_cast<T*>(erased));
+        --size_;
+        return iterator{following};
+    }
+
+    // Destroys the `value`, which must be in this list.
+    void erase(T const& value) noexcept {
+        erase(iterator_to(value));
+    }
+
+    // Destroys all values and resets the pool, which keeps its first block.
+    void clear() noexcept {
+        destroy_values();
+        nodes_.reset();
+        link_root();
+        size_ = 0u;
+    }
+
+private:
+    static list_hook*& prev(list_hook* hook) noexcept {
+        return hook_access::links(*hook).prev;
+    }
+
+    static list_hook*& next(list_hook* hook) noexcept {
+        return hook_access::links(*hook).next;
+    }
+
+    void link_root() noexcept {
+        prev(&root_) = &root_;
+        next(&root_) = &root_;
+    }
+
+    void destroy_values() noexcept {
+        if constexpr (not meta::trivially_destructible<T>) {
+            for (auto* hook = next(&root_); hook != &root_;) {
+                auto* const following = next(hook);
+                ::std::destroy_at(static_cast<T*>(hook));
+                hook = following;
+            }
+        }
+    }
+
+    nodes_type nodes_;
+    list_hook  root_;
+    size_type  size_ = 0u;
+};
+
+} // namespace flux::fou
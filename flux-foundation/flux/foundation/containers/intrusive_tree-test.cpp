@@ -0,0 +1,106 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace flux;
+using namespace flux::fou;
+
+namespace {
+
+struct [[nodiscard]] entry final : tree_hook {
+    explicit entry(int k) noexcept : key{k}, name(32u, 'x') {}
+
+    friend bool operator<(entry const& lhs, entry const& rhs) noexcept {
+        return lhs.key < rhs.key;
+    }
+    friend bool operator<(entry const& lhs, int rhs) noexcept {
+        return lhs.key < rhs;
+    }
+    friend bool operator<(int lhs, entry const& rhs) noexcept {
+        return lhs < rhs.key;
+    }
+
+    int           key;
+    ::std::string name;
+};
+
+template <typename Tree>
+::std::vector<int> keys(Tree const& tree) {
+    ::std::vector<int> result;
+    for (auto const& element : tree)
+        result.push_back(element.key);
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("fou::intrusive_tree", "[flux-containers/intrusive_tree.hpp]") {
+    intrusive_tree<entry> tree{16u};
+    CHECK(tree.empty());
+    CHECK(tree.begin() == tree.end());
+
+    for (int key : {5, 3, 8, 1, 4})
+        CHECK(tree.emplace(key).second);
+    auto const [it, inserted] = tree.emplace(3);
+    CHECK(!inserted);
+    CHECK(it->key == 3);
+    CHECK(tree.size() == 5u);
+    CHECK(keys(tree) == ::std::vector<int>{1, 3, 4, 5, 8});
+
+    CHECK(tree.contains(4));
+    CHECK(!tree.contains(6));
+    CHECK(tree.find(6) == tree.end());
+    CHECK(tree.find(8)->key == 8);
+    CHECK(tree.lower_bound(6)->key == 8);
+    CHECK(tree.lower_bound(9) == tree.end());
+
+    SECTION("erase") {
+        CHECK(tree.erase(3) == 1u);
+        CHECK(tree.erase(3) == 0u);
+        auto following = tree.erase(tree.find(4));
+        CHECK(following->key == 5);
+        CHECK(keys(tree) == ::std::vector<int>{1, 5, 8});
+    }
+    SECTION("clear") {
+        tree.clear();
+        CHECK(tree.empty());
+        CHECK(tree.begin() == tree.end());
+        tree.emplace(2);
+        CHECK(keys(tree) == ::std::vector<int>{2});
+    }
+    SECTION("move") {
+        auto moved = ::std::move(tree);
+        CHECK(tree.empty());
+        CHECK(keys(moved) == ::std::vector<int>{1, 3, 4, 5, 8});
+    }
+}
+
+TEST_CASE("fou::intrusive_tree random", "[flux-containers/intrusive_tree.hpp]") {
+    intrusive_tree<entry> tree;
+    ::std::set<int>       expected;
+    ::std::mt19937        random{42u};
+
+    for (int i = 0; i < 20000; ++i) {
+        auto const key = static_cast<int>(random() % 1000u);
+        if (random() % 3u == 0u) {
+            CHECK(tree.erase(key) == expected.erase(key));
+        } else {
+            CHECK(tree.emplace(key).second == expected.insert(key).second);
+        }
+    }
+    CHECK(tree.size() == expected.size());
+    CHECK(keys(tree) == ::std::vector<int>(expected.begin(), expected.end()));
+
+    // Erases from the front through iterators.
+    while (!tree.empty()) {
+        auto const key = tree.begin()->key;
+        CHECK(key == *expected.begin());
+        tree.erase(tree.begin());
+        expected.erase(expected.begin());
+    }
+}
@@ -0,0 +1,470 @@
+#pragma once
+#include <flux/foundation/containers/detail/intrusive_node_pool.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace flux::fou {
+
+// The links of a value of an `intrusive_tree`, whose value type derives from it.
+// NOTE:
+//  Copying a value does not copy its links.
+class [[nodiscard]] tree_hook {
+public:
+    tree_hook() noexcept = default;
+    tree_hook(tree_hook const&) noexcept {}
+    tree_hook& operator=(tree_hook const&) noexcept {
+        return *this;
+    }
+
+private:
+    // The balance is the height of the right subtree minus the one of the left subtree.
+    struct links {
+        tree_hook*    parent  = nullptr;
+        tree_hook*    left    = nullptr;
+        tree_hook*    right   = nullptr;
+        ::std::int8_t balance = 0;
+    };
+
+    links links_;
+
+    friend detail::hook_access;
+};
+
+namespace detail {
+
+// The rebalancing of an AVL tree, it only touches the links, never the values.
+class [[nodiscard]] avl_tree_algorithms {
+public:
+    static tree_hook*& parent(tree_hook* hook) noexcept {
+        return hook_access::links(*hook).parent;
+    }
+
+    static tree_hook*& left(tree_hook* hook) noexcept {
+        return hook_access::links(*hook).left;
+    }
+
+    static tree_hook*& right(tree_hook* hook) noexcept {
+        return hook_access::links(*hook).right;
+    }
+
+    static ::std::int8_t& balance(tree_hook* hook) noexcept {
+        return hook_access::links(*hook).balance;
+    }
+
+    static tree_hook* leftmost(tree_hook* hook) noexcept {
+        while (left(hook))
+            hook = left(hook);
+        return hook;
+    }
+
+    // Returns the hook that follows `hook` in order, or `nullptr` if it is the last one.
+    static tree_hook* successor(tree_hook* hook) noexcept {
+        if (right(hook))
+            return leftmost(right(hook));
+        auto* ancestor = parent(hook);
+        while (ancestor && hook == right(ancestor)) {
+            hook     = ancestor;
+            ancestor = parent(ancestor);
+        }
+        return ancestor;
+    }
+
+    // Links `hook` as a child of `above`, or as the root if there is none, and rebalances.
+    static void insert(tree_hook*& root, tree_hook* above, tree_hook*& link,
+                       tree_hook* hook) noexcept {
+        parent(hook)  = above;
+        left(hook)    = nullptr;
+        right(hook)   = nullptr;
+        balance(hook) = 0;
+        link          = hook;
+
+        // Walks up while the height of the subtrees grows.
+        for (auto* child = hook; above; child = above, above = parent(above)) {
+            balance(above) =
+                    static_cast<::std::int8_t>(balance(above) + (child == left(above) ? -1 : 1));
+            if (balance(above) == 0)
+                break;
+            if (balance(above) == 2 || balance(above) == -2) {
+                rebalance(root, above);
+                break;
+            }
+        }
+    }
+
+    // Unlinks `hook` and rebalances.
+    static void erase(tree_hook*& root, tree_hook* hook) noexcept {
+        tree_hook* shrunk      = nullptr;
+        bool       shrunk_left = false;
+        if (left(hook) && right(hook)) {
+            // The successor takes the place of the `hook`.
+            auto* const heir   = leftmost(right(hook));
+            balance(heir)      = balance(hook);
+            left(heir)         = left(hook);
+            parent(left(hook)) = heir;
+            if (heir == right(hook)) {
+                shrunk      = heir;
+                shrunk_left = false;
+            } else {
+                shrunk       = parent(heir);
+                shrunk_left  = true;
+                left(shrunk) = right(heir);
+                if (right(heir))
+                    parent(right(heir)) = shrunk;
+                right(heir)         = right(hook);
+                parent(right(hook)) = heir;
+            }
+            replace_child(root, parent(hook), hook, heir);
+            parent(heir) = parent(hook);
+        } else {
+            auto* const child = left(hook) ? left(hook) : right(hook);
+            shrunk            = parent(hook);
+            shrunk_left       = shrunk && hook == left(shrunk);
+            if (child)
+                parent(child) = shrunk;
+            replace_child(root, shrunk, hook, child);
+        }
+
+        // Walks up while the height of the subtrees shrinks.
+        while (shrunk) {
+            balance(shrunk) = static_cast<::std::int8_t>(balance(shrunk) + (shrunk_left ? 1 : -1));
+            if (balance(shrunk) == 1 || balance(shrunk) == -1)
+                break;
+
+            auto* subtree = shrunk;
+            if (balance(shrunk) == 2 || balance(shrunk) == -2) {
+                auto const sibling_balance =
+                        balance(shrunk) == 2 ? balance(right(shrunk)) : balance(left(shrunk));
+                subtree = rebalance(root, shrunk);
+                // A single rotation around a balanced sibling keeps the height.
+                if (sibling_balance == 0)
+                    break;
+            }
+            shrunk = parent(subtree);
+            if (shrunk)
+                shrunk_left = subtree == left(shrunk);
+        }
+    }
+
+private:
+    static void replace_child(tree_hook*& root, tree_hook* above, tree_hook* child,
+                              tree_hook* replacement) noexcept {
+        if (!above)
+            root = replacement;
+        else if (left(above) == child)
+            left(above) = replacement;
+        else
+            right(above) = replacement;
+    }
+
+    // The balances are updated for any balance of the two hooks, so double rotations are made of
+    // two single ones.
+    static void rotate_left(tree_hook*& root, tree_hook* hook) noexcept {
+        auto* const pivot = right(hook);
+        right(hook)       = left(pivot);
+        if (left(pivot))
+            parent(left(pivot)) = hook;
+        replace_child(root, parent(hook), hook, pivot);
+        parent(pivot) = parent(hook);
+        left(pivot)   = hook;
+        parent(hook)  = pivot;
+
+        balance(hook)  = static_cast<::std::int8_t>(balance(hook) - 1 - max(balance(pivot), 0));
+        balance(pivot) = static_cast<::std::int8_t>(balance(pivot) - 1 + min(balance(hook), 0));
+    }
+
+    static void rotate_right(tree_hook*& root, tree_hook* hook) noexcept {
+        auto* const pivot = left(hook);
+        left(hook)        = right(pivot);
+        if (right(pivot))
+            parent(right(pivot)) = hook;
+        replace_child(root, parent(hook), hook, pivot);
+        parent(pivot) = parent(hook);
+        right(pivot)  = hook;
+        parent(hook)  = pivot;
+
+        balance(hook)  = static_cast<::std::int8_t>(balance(hook) + 1 - min(balance(pivot), 0));
+        balance(pivot) = static_cast<::std::int8_t>(balance(pivot) + 1 + max(balance(hook), 0));
+    }
+
+    // Restores the balance of `hook`, which is 2 or -2, and returns the root of its subtree.
+    static tree_hook* rebalance(tree_hook*& root, tree_hook* hook) noexcept {
+        if (balance(hook) > 0) {
+            if (balance(right(hook)) < 0)
+                rotate_right(root, right(hook));
+            rotate_left(root, hook);
+        } else {
+            if (balance(left(hook)) > 0)
+                rotate_left(root, left(hook));
+            rotate_right(root, hook);
+        }
+        return parent(hook);
+    }
+
+    static int max(int lhs, int rhs) noexcept {
+        return lhs > rhs ? lhs : rhs;
+    }
+
+    static int min(int lhs, int rhs) noexcept {
+        return lhs < rhs ? lhs : rhs;
+    }
+};
+
+template <typename Value>
+class tree_iterator {
+public:
+    using value_type        = meta::remove_cv_t<Value>;
+    using difference_type   = ::std::ptrdiff_t;
+    using reference         = Value&;
+    using pointer           = Value*;
+    using iterator_category = ::std::forward_iterator_tag;
+
+    tree_iterator() noexcept = default;
+
+    explicit tree_iterator(tree_hook* hook) noexcept : hook_{hook} {}
+
+    operator tree_iterator<Value const>() const noexcept
+        requires(not ::std::is_const_v<Value>)
+    {
+        return tree_iterator<Value const>{hook_};
+    }
+
+    Value& operator*() const noexcept {
+        return static_cast<value_type&>(*hook_);
+    }
+
+    Value* operator->() const noexcept {
+        return fou::addressof(**this);
+    }
+
+    tree_iterator& operator++() noexcept {
+        hook_ = avl_tree_algorithms::successor(hook_);
+        return *this;
+    }
+
+    tree_iterator operator++(int) noexcept {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    bool operator==(tree_iterator const&) const noexcept = default;
+
+private:
+    tree_hook* hook_ = nullptr;
+
+    friend hook_access;
+};
+
+} // namespace detail
+
+// An ordered set of values that derive from `tree_hook`, kept in an AVL tree. The values are
+// constructed in a `memory_pool` of nodes of their size, so inserting only allocates when the pool
+// grows and `clear()` returns all nodes at once by resetting it. The values are unique according
+// to `Compare`, which may be transparent to look them up by key.
+// NOTE:
+//  It owns its pool, so it can be moved but not assigned. The values must not be modified in a
+//  way that changes their order.
+template <typename T, typename Compare = ::std::less<>,
+          typename BlockOrRawAllocator = default_allocator>
+    requires(meta::derived_from<T, tree_hook> and meta::nothrow_destructible<T>)
+class [[nodiscard]] intrusive_tree {
+    using nodes_type = detail::intrusive_node_pool<T, BlockOrRawAllocator>;
+    using algorithms = detail::avl_tree_algorithms;
+
+public:
+    using value_type      = T;
+    using key_compare     = Compare;
+    using size_type       = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+    using reference       = T&;
+    using const_reference = T const&;
+    using iterator        = detail::tree_iterator<T>;
+    using const_iterator  = detail::tree_iterator<T const>;
+
+    intrusive_tree() noexcept : intrusive_tree{nodes_type::default_nodes_per_block} {}
+
+    // The pool allocates blocks of `nodes_per_block` values, the `args` are forwarded to its
+    // block allocator.
+    template <typename... Args>
+    explicit intrusive_tree(size_type nodes_per_block, Args&&... args) noexcept
+            : nodes_{nodes_per_block, ::std::forward<Args>(args)...} {}
+
+    intrusive_tree(intrusive_tree&& other) noexcept
+            : nodes_{::std::move(other.nodes_)}, root_{::std::exchange(other.root_, nullptr)},
+              size_{::std::exchange(other.size_, 0u)}, compare_{other.compare_} {}
+
+    ~intrusive_tree() {
+        destroy_values();
+    }
+
+    iterator begin() noexcept {
+        return iterator{root_ ? algorithms::leftmost(root_) : nullptr};
+    }
+    const_iterator begin() const noexcept {
+        return const_iterator{root_ ? algorithms::leftmost(root_) : nullptr};
+    }
+
+    iterator end() noexcept {
+        return iterator{};
+    }
+    const_iterator end() const noexcept {
+        return const_iterator{};
+    }
+
+    // Returns an iterator to the `value`, which must be in this tree.
+    iterator iterator_to(T& value) noexcept {
+        return iterator{&value};
+    }
+    const_iterator iterator_to(T const& value) const noexcept {
+        return const_iterator{const_cast<T*>(&value)};
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0u;
+    }
+
+    // Constructs a value and links it unless an equivalent one is in the tree already, in which
+    // case it is destroyed again. Returns an iterator to the value in the tree and whether it has
+    // been inserted.
+    template <typename... Args>
+        requires(meta::nothrow_constructible<T, Args...>)
+    ::std::pair<iterator, bool> emplace(Args&&... args) noexcept {
+        auto* const value = nodes_.create(::std::forward<Args>(args)...);
+
+        tree_hook*  parent = nullptr;
+        tree_hook** link   = &root_;
+        while (*link) {
+            parent = *link;
+            if (compare_(*value, as_value(parent)))
+                link = &algorithms::left(parent);
+            else if (compare_(as_value(parent), *value))
+                link = &algorithms::right(parent);
+            else {
+                nodes_.destroy(value);
+                return {iterator{parent}, false};
+            }
+        }
+        algorithms::insert(root_, parent, *link, value);
+        ++size_;
+        return {iterator{value}, true};
+    }
+
+    ::std::pair<iterator, bool> insert(T const& value) noexcept
+        requires meta::copy_constructible<T>
+    {
+        return emplace(value);
+    }
+
+    ::std::pair<iterator, bool> insert(T&& value) noexcept {
+        return emplace(::std::move(value));
+    }
+
+    template <typename Key>
+    iterator find(Key const& key) noexcept {
+        return iterator{find_hook(key)};
+    }
+    template <typename Key>
+    const_iterator find(Key const& key) const noexcept {
+        return const_iterator{find_hook(key)};
+    }
+
+    template <typename Key>
+    bool contains(Key const& key) const noexcept {
+        return find_hook(key) != nullptr;
+    }
+
+    // Returns an iterator to the first value that is not less than the `key`.
+    template <typename Key>
+    iterator lower_bound(Key const& key) noexcept {
+        return iterator{lower_bound_hook(key)};
+    }
+    template <typename Key>
+    const_iterator lower_bound(Key const& key) const noexcept {
+        return const_iterator{lower_bound_hook(key)};
+    }
+
+    // Destroys the value at `position` and returns an iterator to the one that followed it.
+    iterator erase(const_iterator position) noexcept {
+        auto* const erased    = detail::hook_access::hook(position);
+        auto* const following = algorithms::successor(erased);
+        algorithms::erase(root_, erased);
+        nodes_.destroy(static_cast<T*>(erased));
+        --size_;
+        return iterator{following};
+    }
+
+    // Destroys the value that is equivalent to the `key`, returns how many have been destroyed.
+    template <typename Key>
+        requires(not meta::convertible_to<Key const&, const_iterator>)
+    size_type erase(Key const& key) noexcept {
+        auto* const erased = find_hook(key);
+        if (!erased)
+            return 0u;
+        erase(const_iterator{erased});
+        return 1u;
+    }
+
+    // Destroys all values and resets the pool, which keeps its first block.
+    void clear() noexcept {
+        destroy_values();
+        nodes_.reset();
+        root_ = nullptr;
+        size_ = 0u;
+    }
+
+private:
+    static T& as_value(tree_hook* hook) noexcept {
+        return static_cast<T&>(*hook);
+    }
+
+    template <typename Key>
+    tree_hook* find_hook(Key const& key) const noexcept {
+        auto* const hook = lower_bound_hook(key);
+        return hook && !compare_(key, as_value(hook)) ? hook : nullptr;
+    }
+
+    template <typename Key>
+    tree_hook* lower_bound_hook(Key const& key) const noexcept {
+        tree_hook* bound = nullptr;
+        for (auto* hook = root_; hook;) {
+            if (compare_(as_value(hook), key)) {
+                hook = algorithms::right(hook);
+            } else {
+                bound = hook;
+                hook  = algorithms::left(hook);
+            }
+        }
+        return bound;
+    }
+
+    // Destroys the values from the leaves up, so that no link is read after its value is gone.
+    void destroy_values() noexcept {
+        if constexpr (not meta::trivially_destructible<T>) {
+            for (auto* hook = root_; hook;) {
+                if (algorithms::left(hook)) {
+                    hook = ::std::exchange(algorithms::left(hook), nullptr);
+                } else if (algorithms::right(hook)) {
+                    hook = ::std::exchange(algorithms::right(hook), nullptr);
+                } else {
+                    auto* const parent = algorithms::parent(hook);
+                    ::std::destroy_at(static_cast<T*>(hook));
+                    hook = parent;
+                }
+            }
+        }
+    }
+
+    nodes_type                     nodes_;
+    tree_hook*                     root_ = nullptr;
+    size_type                      size_ = 0u;
+    FLUX_NO_UNIQUE_ADDRESS Compare compare_;
+};
+
+} // namespace flux::fou
@@ -0,0 +1,123 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace flux;
+using namespace flux::fou;
+
+TEST_CASE("fou::slot_handle", "[flux-containers/slot_map.hpp]") {
+    static_assert(sizeof(slot_handle) == 8u);
+
+    slot_handle const null;
+    CHECK(!null);
+
+    slot_handle const handle{3u, 7u};
+    CHECK(handle);
+    CHECK(handle.value() == 0x0000'0007'0000'0003u);
+    CHECK(slot_handle::from_value(handle.value()) == handle);
+
+    // Any handle with the null index is the null handle.
+    CHECK(slot_handle{slot_handle::npos, 5u} == null);
+    CHECK(slot_handle::from_value(0x0000'0005'ffff'ffffu) == null);
+}
+
+TEST_CASE("fou::slot_map", "[flux-containers/slot_map.hpp]") {
+    slot_map<::std::string> map;
+    CHECK(map.empty());
+    CHECK(!map.contains(slot_handle{}));
+    CHECK(map.find(slot_handle{0u, 0u}) == nullptr);
+
+    auto const a = map.emplace(::std::string(3u, 'a'));
+    auto const b = map.insert(::std::string{"bb"});
+    auto const c = map.insert(::std::string{"ccc"});
+    CHECK(map.size() == 3u);
+    CHECK(map[a] == "aaa");
+    CHECK(*map.find(b) == "bb");
+    CHECK(map.contains(c));
+
+    SECTION("erase") {
+        CHECK(map.erase(a));
+        CHECK(!map.erase(a));
+        CHECK(!map.contains(a));
+        CHECK(map.find(a) == nullptr);
+        CHECK(map.size() == 2u);
+        CHECK(map[b] == "bb");
+        CHECK(map[c] == "ccc");
+        CHECK(map.data()[0] == "ccc");
+
+        // The slot is reused with a new generation.
+        auto const d = map.insert(::std::string{"d"});
+        CHECK(d.index() == a.index());
+        CHECK(d.generation() != a.generation());
+        CHECK(!map.contains(a));
+        CHECK(map[d] == "d");
+    }
+    SECTION("iteration") {
+        ::std::vector<::std::string> values(map.begin(), map.end());
+        CHECK(values == ::std::vector<::std::string>{"aaa", "bb", "ccc"});
+        for (::std::size_t i = 0u; i < map.size(); ++i)
+            CHECK(&map[map.handle_at(i)] == map.data() + i);
+    }
+    SECTION("clear") {
+        map.clear();
+        CHECK(map.empty());
+        CHECK(!map.contains(a));
+        CHECK(!map.contains(b));
+        CHECK(!map.contains(c));
+        auto const d = map.insert(::std::string{"d"});
+        CHECK(map.size() == 1u);
+        CHECK(map[d] == "d");
+    }
+    SECTION("copy and move") {
+        auto copy = map;
+        CHECK(copy[b] == "bb");
+        copy.erase(b);
+        CHECK(map.contains(b));
+
+        auto moved = ::std::move(copy);
+        CHECK(moved.size() == 2u);
+        CHECK(moved[c] == "ccc");
+
+        // The moved-from map starts over, without the free slot of the erased value.
+        CHECK(copy.empty());
+        auto const d = copy.insert(::std::string{"d"});
+        CHECK(d.index() == 0u);
+        CHECK(copy[d] == "d");
+        CHECK(copy.erase(d));
+        CHECK(copy.empty());
+
+        copy = ::std::move(moved);
+        CHECK(copy.size() == 2u);
+        CHECK(moved.insert(::std::string{"e"}) != slot_handle{});
+        CHECK(moved.size() == 1u);
+        CHECK(moved.erase(moved.insert(::std::string{"f"})));
+    }
+}
+
+TEST_CASE("fou::slot_map churn", "[flux-containers/slot_map.hpp]") {
+    memory_stack<>                stack{1u << 16u};
+    slot_map<int, memory_stack<>> map{stack};
+    ::std::vector<slot_handle>    handles;
+    for (int i = 0; i < 1000; ++i)
+        handles.push_back(map.emplace(i));
+
+    // Erases every other value, the remaining ones keep their handles.
+    for (::std::size_t i = 0u; i < handles.size(); i += 2u)
+        CHECK(map.erase(handles[i]));
+    CHECK(map.size() == 500u);
+    for (::std::size_t i = 0u; i < handles.size(); ++i) {
+        CHECK(map.contains(handles[i]) == (i % 2u == 1u));
+        if (i % 2u == 1u)
+            CHECK(map[handles[i]] == static_cast<int>(i));
+    }
+
+    // The free slots are reused before new ones are added.
+    for (int i = 0; i < 500; ++i)
+        CHECK(map.emplace(i).index() < 1000u);
+    CHECK(map.size() == 1000u);
+    for (auto const& handle : handles)
+        CHECK(map.contains(handle) == (handle.index() % 2u == 1u));
+}
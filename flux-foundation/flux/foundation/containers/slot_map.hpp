@@ -0,0 +1,314 @@
+#pragma once
+#include <flux/foundation/containers/dynamic_array.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+namespace flux::fou {
+
+// Refers to a value of a `slot_map`, it packs the index of a slot and its generation into 64 bits.
+// It stays valid while the value lives, erasing the value bumps the generation of the slot, so a
+// stale handle is detected even after the slot has been reused.
+class [[nodiscard]] slot_handle {
+public:
+    using index_type      = ::std::uint32_t;
+    using generation_type = ::std::uint32_t;
+
+    static constexpr index_type npos = UINT32_MAX;
+
+    // A null handle, it never refers to a value.
+    constexpr slot_handle() noexcept = default;
+
+    // A handle with the null index is a null handle, whatever the `generation`.
+    constexpr slot_handle(index_type index, generation_type generation) noexcept
+            : index_{index}, generation_{index != npos ? generation : 0u} {}
+
+    // Restores a handle from its `value()`.
+    static constexpr slot_handle from_value(::std::uint64_t value) noexcept {
+        return {static_cast<index_type>(value), static_cast<generation_type>(value >> 32u)};
+    }
+
+    constexpr ::std::uint64_t value() const noexcept {
+        return static_cast<::std::uint64_t>(generation_) << 32u | index_;
+    }
+
+    constexpr index_type index() const noexcept {
+        return index_;
+    }
+
+    constexpr generation_type generation() const noexcept {
+        return generation_;
+    }
+
+    constexpr explicit operator bool() const noexcept {
+        return index_ != npos;
+    }
+
+    constexpr bool operator==(slot_handle const&) const noexcept = default;
+
+private:
+    index_type      index_      = npos;
+    generation_type generation_ = 0u;
+};
+
+// Stores values of `T` in a dense array and hands out `slot_handle`s to them, which are resolved
+// through a sparse array of slots. Inserting, erasing and looking up take constant time, iterating
+// walks the dense array. Erasing moves the last value into the hole, so the order is not kept.
+// Free slots are linked into an intrusive list through their index, the one freed last is reused
+// first.
+// NOTE:
+//  Pointers and iterators to the values are invalidated by inserting and erasing, handles are not.
+//  A slot whose generation wraps around is never reused.
+template <meta::nothrow_move_constructible T, raw_allocator RawAllocator = default_allocator>
+    requires meta::nothrow_destructible<T>
+class [[nodiscard]] slot_map {
+    using allocator_reference = allocator_reference<RawAllocator>;
+    using index_type          = slot_handle::index_type;
+
+    // The index of the value if the slot is used, or of the next free slot.
+    struct slot {
+        index_type                   index;
+        slot_handle::generation_type generation;
+    };
+
+public:
+    using value_type      = T;
+    using handle_type     = slot_handle;
+    using allocator_type  = typename allocator_reference::allocator_type;
+    using size_type       = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+    using reference       = T&;
+    using const_reference = T const&;
+    using iterator        = T*;
+    using const_iterator  = T const*;
+
+    slot_map() noexcept
+        requires(not is_stateful_allocator<allocator_type>::value)
+            : slot_map{allocator_type{}} {}
+
+    explicit slot_map(allocator_reference allocator) noexcept
+            : values_{allocator}, value_slots_{allocator}, slots_{allocator} {}
+
+    slot_map(slot_map const&) noexcept = default;
+
+    // The moved-from map is empty, its free list too.
+    slot_map(slot_map&& other) noexcept
+            : values_{::std::move(other.values_)},
+              value_slots_{::std::move(other.value_slots_)},
+              slots_{::std::move(other.slots_)},
+              free_slots_{::std::exchange(other.free_slots_, slot_handle::npos)} {}
+
+    slot_map& operator=(slot_map const&) noexcept = default;
+
+    slot_map& operator=(slot_map&& other) noexcept {
+        values_      = ::std::move(other.values_);
+        value_slots_ = ::std::move(other.value_slots_);
+        slots_       = ::std::move(other.slots_);
+        free_slots_  = ::std::exchange(other.free_slots_, slot_handle::npos);
+        return *this;
+    }
+
+    iterator begin() noexcept {
+        return values_.begin();
+    }
+    const_iterator begin() const noexcept {
+        return values_.begin();
+    }
+
+    iterator end() noexcept {
+        return values_.end();
+    }
+    const_iterator end() const noexcept {
+        return values_.end();
+    }
+
+    // Returns the value of the `handle`, or `nullptr` if it has been erased.
+    T* find(slot_handle handle) noexcept {
+        auto const index = value_index(handle);
+        return index != slot_handle::npos ? values_.data() + index : nullptr;
+    }
+    T const* find(slot_handle handle) const noexcept {
+        auto const index = value_index(handle);
+        return index != slot_handle::npos ? values_.data() + index : nullptr;
+    }
+
+    bool contains(slot_handle handle) const noexcept {
+        return value_index(handle) != slot_handle::npos;
+    }
+
+    // The `handle` must refer to a value.
+    T& operator[](slot_handle handle) noexcept {
+        FLUX_ASSERT(contains(handle));
+        return values_[slots_[handle.index()].index];
+    }
+    T const& operator[](slot_handle handle) const noexcept {
+        FLUX_ASSERT(contains(handle));
+        return values_[slots_[handle.index()].index];
+    }
+
+    // Returns the handle of the value at `index` of the dense array.
+    slot_handle handle_at(size_type index) const noexcept {
+        auto const slot_index = value_slots_[index];
+        return {slot_index, slots_[slot_index].generation};
+    }
+
+    T* data() noexcept {
+        return values_.data();
+    }
+    T const* data() const noexcept {
+        return values_.data();
+    }
+
+    size_type size() const noexcept {
+        return values_.size();
+    }
+
+    bool empty() const noexcept {
+        return values_.empty();
+    }
+
+    size_type capacity() const noexcept {
+        return values_.capacity();
+    }
+
+    allocator_reference get_allocator() const noexcept {
+        return values_.get_allocator();
+    }
+
+    // Makes room for at least `count` values.
+    void reserve(size_type count) noexcept {
+        values_.reserve(count);
+        value_slots_.reserve(count);
+        slots_.reserve(count);
+    }
+
+    // Erases all values, their handles become stale.
+    void clear() noexcept {
+        for (auto const slot_index : value_slots_)
+            free_slot(slot_index);
+        values_.clear();
+        value_slots_.clear();
+    }
+
+    // Constructs a value and returns its handle.
+    template <typename... Args>
+        requires meta::nothrow_constructible<T, Args...>
+    slot_handle emplace(Args&&... args) noexcept {
+        if (values_.size() == slot_handle::npos) [[unlikely]]
+            fast_terminate();
+
+        auto const slot_index = allocate_slot();
+        auto&      used       = slots_[slot_index];
+        used.index            = static_cast<index_type>(values_.size());
+        values_.emplace_back(::std::forward<Args>(args)...);
+        value_slots_.push_back(slot_index);
+        return {slot_index, used.generation};
+    }
+
+    slot_handle insert(T const& value) noexcept
+        requires meta::copy_constructible<T>
+    {
+        return emplace(value);
+    }
+
+    slot_handle insert(T&& value) noexcept {
+        return emplace(::std::move(value));
+    }
+
+    // Destroys the value of the `handle` and moves the last value into its place, returns false if
+    // it had been erased already.
+    bool erase(slot_handle handle) noexcept {
+        auto const index = value_index(handle);
+        if (index == slot_handle::npos)
+            return false;
+
+        auto const last = static_cast<index_type>(values_.size() - 1u);
+        if (index != last) {
+            auto* const hole = values_.data() + index;
+            ::std::destroy_at(hole);
+            ::std::construct_at(hole, ::std::move(values_[last]));
+
+            value_slots_[index]               = value_slots_[last];
+            slots_[value_slots_[index]].index = index;
+        }
+        values_.pop_back();
+        value_slots_.pop_back();
+        free_slot(handle.index());
+        return true;
+    }
+
+private:
+    // Returns the index of the value of the `handle`, or `npos` if it has been erased.
+    index_type value_index(slot_handle handle) const noexcept {
+        if (handle.index() >= slots_.size())
+            return slot_handle::npos;
+        auto const& used = slots_[handle.index()];
+        return used.generation == handle.generation() ? used.index : slot_handle::npos;
+    }
+
+    index_type allocate_slot() noexcept {
+        if (free_slots_ != slot_handle::npos) {
+            auto const slot_index = free_slots_;
+            free_slots_           = slots_[slot_index].index;
+            return slot_index;
+        }
+        if (slots_.size() == slot_handle::npos) [[unlikely]]
+            fast_terminate();
+
+        slots_.push_back({slot_handle::npos, 0u});
+        return static_cast<index_type>(slots_.size() - 1u);
+    }
+
+    // Bumps the generation of the slot and links it into the free list.
+    void free_slot(index_type slot_index) noexcept {
+        auto& freed = slots_[slot_index];
+        if (++freed.generation == 0u) [[unlikely]] {
+            // Handles with every generation may exist, the slot is retired.
+            freed.index = slot_handle::npos;
+            return;
+        }
+        freed.index = free_slots_;
+        free_slots_ = slot_index;
+    }
+
+    dynamic_array<T, RawAllocator>          values_;
+    dynamic_array<index_type, RawAllocator> value_slots_;
+    dynamic_array<slot, RawAllocator>       slots_;
+    index_type                              free_slots_ = slot_handle::npos;
+};
+
+} // namespace flux::fou
+
+namespace flux::meta {
+
+// A null handle always has generation 0, the constructor makes sure of it, so the handles with the
+// null index and any other generation are niches, a `compact_optional<slot_handle>` is as big as a
+// `slot_handle`. Since no handle can be constructed with them, their bytes are written directly:
+// the index, followed by the generation.
+template <>
+struct [[nodiscard]] niche_traits<fou::slot_handle> {
+    using handle_type = fou::slot_handle;
+
+    static constexpr ::std::size_t count = handle_type::npos;
+
+    static void store(void* storage, ::std::size_t niche) noexcept {
+        static_assert(sizeof(handle_type) ==
+                      sizeof(handle_type::index_type) + sizeof(handle_type::generation_type));
+
+        auto const index      = handle_type::npos;
+        auto const generation = static_cast<handle_type::generation_type>(niche + 1u);
+        auto const bytes      = static_cast<unsigned char*>(storage);
+        ::std::memcpy(bytes, &index, sizeof(index));
+        ::std::memcpy(bytes + sizeof(index), &generation, sizeof(generation));
+    }
+
+    static ::std::size_t load(void const* storage) noexcept {
+        handle_type handle;
+        ::std::memcpy(&handle, storage, sizeof(handle));
+        return not handle and handle.generation() != 0u ? handle.generation() - 1u : count;
+    }
+};
+
+} // namespace flux::meta
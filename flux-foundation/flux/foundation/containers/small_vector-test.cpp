@@ -0,0 +1,109 @@
+#include <flux/foundation.hpp>
+#include <flux/foundation/containers/detail/test_types.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+
+using namespace flux;
+using namespace flux::fou;
+
+TEST_CASE("fou::small_vector", "[flux-containers/small_vector.hpp]") {
+    small_vector<int, 8> vector;
+    CHECK(vector.empty());
+    CHECK(vector.is_inline());
+    CHECK(vector.capacity() == 8u);
+
+    for (int i = 0; i < 8; ++i)
+        vector.push_back(i);
+    CHECK(vector.is_inline());
+
+    vector.push_back(8);
+    CHECK(!vector.is_inline());
+    CHECK(vector.capacity() >= 9u);
+    for (int i = 0; i < 9; ++i)
+        CHECK(vector[static_cast<::std::size_t>(i)] == i);
+
+    SECTION("shrink_to_fit") {
+        vector.resize(4u);
+        vector.shrink_to_fit();
+        CHECK(vector.is_inline());
+        CHECK(vector.size() == 4u);
+        CHECK(vector.back() == 3);
+    }
+    SECTION("insert and erase") {
+        int const values[] = {-1, -2, -3};
+        auto      it       = vector.insert(vector.begin() + 2, values, values + 3);
+        CHECK(it == vector.begin() + 2);
+        CHECK(vector.size() == 12u);
+        CHECK(vector[2u] == -1);
+        CHECK(vector[5u] == 2);
+
+        it = vector.erase(vector.begin() + 2, vector.begin() + 5);
+        CHECK(*it == 2);
+        for (int i = 0; i < 9; ++i)
+            CHECK(vector[static_cast<::std::size_t>(i)] == i);
+
+        vector.emplace(vector.begin(), vector.back());
+        CHECK(vector.front() == 8);
+    }
+    SECTION("copy and move") {
+        auto copy = vector;
+        CHECK(copy.size() == 9u);
+
+        auto const* data  = copy.data();
+        auto        moved = ::std::move(copy);
+        CHECK(moved.data() == data);
+        CHECK(copy.empty());
+        CHECK(copy.is_inline());
+
+        small_vector<int, 8> small{1, 2, 3};
+        moved = ::std::move(small);
+        CHECK(moved.size() == 3u);
+        CHECK(moved[2u] == 3);
+        CHECK(small.empty());
+
+        copy = moved;
+        CHECK(copy.is_inline());
+        CHECK(copy.back() == 3);
+    }
+}
+
+TEST_CASE("fou::small_vector relocation", "[flux-containers/small_vector.hpp]") {
+    SECTION("not trivially relocatable") {
+        small_vector<self_aware, 4> vector;
+        for (int i = 0; i < 4; ++i)
+            vector.emplace_back(i);
+        CHECK(vector.is_inline());
+        vector.emplace_back(4);
+        CHECK(!vector.is_inline());
+        CHECK(is_valid(vector));
+
+        auto moved = ::std::move(vector);
+        CHECK(is_valid(moved));
+        moved.resize(2u, self_aware{0});
+        moved.shrink_to_fit();
+        CHECK(moved.is_inline());
+        CHECK(is_valid(moved));
+
+        vector = ::std::move(moved);
+        CHECK(is_valid(vector));
+        CHECK(vector.size() == 2u);
+        CHECK(vector.back().value == 1);
+    }
+    SECTION("strings") {
+        small_vector<::std::string, 2> vector{"a", "b"};
+        vector.insert(vector.begin() + 1, ::std::string(32u, 'x'));
+        CHECK(!vector.is_inline());
+        CHECK(vector[1u] == ::std::string(32u, 'x'));
+        CHECK(vector[2u] == "b");
+    }
+    SECTION("spills to any allocator") {
+        memory_stack<>                       stack{4096u};
+        small_vector<int, 4, memory_stack<>> vector{stack};
+        for (int i = 0; i < 64; ++i)
+            vector.push_back(i);
+        CHECK(!vector.is_inline());
+        CHECK(vector.back() == 63);
+    }
+}
@@ -0,0 +1,108 @@
+#include <flux/foundation.hpp>
+#include <flux/foundation/containers/detail/test_types.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <string>
+
+using namespace flux;
+using namespace flux::fou;
+
+namespace {
+
+template <typename T>
+bool is_column_aligned(T const* column) noexcept {
+    return reinterpret_cast<::std::uintptr_t>(column) % 64u == 0u;
+}
+
+} // namespace
+
+TEST_CASE("fou::soa_vector", "[flux-containers/soa_vector.hpp]") {
+    soa_vector<float, double, char> vector;
+    CHECK(vector.empty());
+    CHECK(vector.column<0>().empty());
+
+    for (int i = 0; i < 1000; ++i)
+        vector.emplace_back(static_cast<float>(i), i * 0.5, static_cast<char>('a' + i % 26));
+    CHECK(vector.size() == 1000u);
+    CHECK(vector.capacity() >= 1000u);
+    CHECK(is_column_aligned(vector.data<0>()));
+    CHECK(is_column_aligned(vector.data<1>()));
+    CHECK(is_column_aligned(vector.data<2>()));
+
+    auto [x, y, c] = vector[10u];
+    CHECK(x == 10.0f);
+    CHECK(y == 5.0);
+    CHECK(c == 'k');
+    x = -1.0f;
+    CHECK(vector.column<0>()[10u] == -1.0f);
+
+    double sum = 0.0;
+    for (auto const value : vector.column<1>())
+        sum += value;
+    CHECK(sum == 999.0 * 1000.0 / 4.0);
+
+    SECTION("erase") {
+        vector.erase(0u);
+        CHECK(vector.size() == 999u);
+        CHECK(::std::get<0>(vector.front()) == 1.0f);
+        CHECK(::std::get<2>(vector.back()) == 'a' + 999 % 26);
+
+        vector.swap_erase(0u);
+        CHECK(vector.size() == 998u);
+        CHECK(::std::get<0>(vector.front()) == 999.0f);
+
+        vector.pop_back();
+        CHECK(::std::get<0>(vector.back()) == 997.0f);
+    }
+    SECTION("resize and shrink_to_fit") {
+        vector.resize(10u);
+        vector.shrink_to_fit();
+        CHECK(vector.capacity() == 10u);
+        CHECK(::std::get<1>(vector.back()) == 4.5);
+        vector.resize(12u);
+        CHECK(::std::get<0>(vector[11u]) == 0.0f);
+        CHECK(is_column_aligned(vector.data<2>()));
+    }
+    SECTION("copy and move") {
+        auto copy = vector;
+        CHECK(copy.size() == 1000u);
+        CHECK(::std::get<1>(copy[999u]) == 499.5);
+
+        auto moved = ::std::move(copy);
+        CHECK(copy.empty());
+        CHECK(moved.size() == 1000u);
+
+        copy = moved;
+        CHECK(copy.column<2>().size() == 1000u);
+        moved.push_back({1.0f, 2.0, 'z'});
+        CHECK(::std::get<2>(moved.back()) == 'z');
+    }
+}
+
+TEST_CASE("fou::soa_vector non-trivial fields", "[flux-containers/soa_vector.hpp]") {
+    soa_vector<::std::string, self_aware, int> vector;
+    for (int i = 0; i < 100; ++i)
+        vector.emplace_back(::std::string(32u, static_cast<char>('a' + i % 26)), self_aware{i}, i);
+    for (::std::size_t i = 0u; i < vector.size(); ++i) {
+        auto const& [string, aware, value] = vector[i];
+        CHECK(aware.self == &aware);
+        CHECK(aware.value == value);
+        CHECK(string.size() == 32u);
+    }
+
+    vector.erase(50u);
+    vector.swap_erase(0u);
+    for (auto const& aware : vector.column<1>())
+        CHECK(aware.self == &aware);
+    CHECK(vector.column<1>()[0u].value == 99);
+    CHECK(vector.column<2>()[50u] == 51);
+
+    memory_stack<>                                             stack{1u << 16u};
+    basic_soa_vector<memory_stack<>, ::std::string, self_aware> stacked{stack};
+    for (int i = 0; i < 100; ++i)
+        stacked.emplace_back(::std::string{}, self_aware{i});
+    CHECK(stacked.size() == 100u);
+    CHECK(::std::get<1>(stacked.back()).value == 99);
+}
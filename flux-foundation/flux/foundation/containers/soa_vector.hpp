@@ -0,0 +1,360 @@
+#pragma once
+#include <flux/foundation/containers/detail/gap.hpp>
+#include <flux/foundation/memory/align.hpp>
+#include <flux/foundation/memory/allocator_storage.hpp>
+#include <flux/foundation/memory/default_allocator.hpp>
+#include <flux/foundation/memory/uninitialized_algorithms.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <utility>
+
+namespace flux::fou {
+
+// A growable array of records with the fields `Ts...`, stored as a struct of arrays: every field
+// has its own contiguous column, so a loop over one field only loads that field into the cache.
+// The columns are carved from a single block of the `RawAllocator`, each of them aligned to
+// `column_alignment`. Rows are accessed as tuples of references, columns as spans.
+// When it grows, every column is relocated with `uninitialized_relocate`, which is a single
+// `memmove` per column for trivially relocatable fields.
+// NOTE:
+//  Growing invalidates pointers, spans and rows.
+template <raw_allocator RawAllocator, typename... Ts>
+    requires(sizeof...(Ts) > 0u and (meta::nothrow_move_constructible<Ts> and ...) and
+             (meta::nothrow_destructible<Ts> and ...))
+class [[nodiscard]] basic_soa_vector {
+    using allocator_reference = allocator_reference<RawAllocator>;
+    using columns_type        = ::std::tuple<Ts*...>;
+    using column_indices      = ::std::index_sequence_for<Ts...>;
+
+public:
+    using value_type      = ::std::tuple<Ts...>;
+    using reference       = ::std::tuple<Ts&...>;
+    using const_reference = ::std::tuple<Ts const&...>;
+    using allocator_type  = typename allocator_reference::allocator_type;
+    using size_type       = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+
+    template <::std::size_t I>
+    using column_type = ::std::tuple_element_t<I, value_type>;
+
+    // A cache line, which is also the width of the widest vector registers.
+    static constexpr size_type column_alignment = ::std::max({::std::size_t{64u}, alignof(Ts)...});
+
+    basic_soa_vector() noexcept
+        requires(not is_stateful_allocator<allocator_type>::value)
+            : basic_soa_vector{allocator_type{}} {}
+
+    explicit basic_soa_vector(allocator_reference allocator) noexcept : allocator_{allocator} {}
+
+    // Constructs `count` rows of value-initialized fields.
+    explicit basic_soa_vector(size_type count) noexcept
+        requires(not is_stateful_allocator<allocator_type>::value and
+                 (meta::default_initializable<Ts> and ...))
+            : basic_soa_vector{count, allocator_type{}} {}
+
+    basic_soa_vector(size_type count, allocator_reference allocator) noexcept
+        requires(meta::default_initializable<Ts> and ...)
+            : basic_soa_vector{allocator} {
+        resize(count);
+    }
+
+    // The copy allocates from the same allocator.
+    basic_soa_vector(basic_soa_vector const& other) noexcept
+        requires(meta::copy_constructible<Ts> and ...)
+            : basic_soa_vector{other.allocator_} {
+        copy_rows(other);
+    }
+
+    basic_soa_vector(basic_soa_vector&& other) noexcept
+            : memory_{::std::exchange(other.memory_, nullptr)},
+              columns_{::std::exchange(other.columns_, columns_type{})},
+              size_{::std::exchange(other.size_, 0u)},
+              capacity_{::std::exchange(other.capacity_, 0u)},
+              allocator_{other.allocator_} {}
+
+    ~basic_soa_vector() {
+        clear();
+        release();
+    }
+
+    basic_soa_vector& operator=(basic_soa_vector const& other) noexcept
+        requires(meta::copy_constructible<Ts> and ...)
+    {
+        if (this != &other) {
+            clear();
+            copy_rows(other);
+        }
+        return *this;
+    }
+
+    basic_soa_vector& operator=(basic_soa_vector&& other) noexcept {
+        if (this != &other) {
+            clear();
+            release();
+            memory_    = ::std::exchange(other.memory_, nullptr);
+            columns_   = ::std::exchange(other.columns_, columns_type{});
+            size_      = ::std::exchange(other.size_, 0u);
+            capacity_  = ::std::exchange(other.capacity_, 0u);
+            allocator_ = other.allocator_;
+        }
+        return *this;
+    }
+
+    reference operator[](size_type index) noexcept {
+        FLUX_ASSERT(index < size_);
+        return ::std::apply([index](Ts*... columns) { return reference{columns[index]...}; },
+                            columns_);
+    }
+    const_reference operator[](size_type index) const noexcept {
+        FLUX_ASSERT(index < size_);
+        return ::std::apply([index](Ts*... columns) { return const_reference{columns[index]...}; },
+                            columns_);
+    }
+
+    reference front() noexcept {
+        return (*this)[0u];
+    }
+    const_reference front() const noexcept {
+        return (*this)[0u];
+    }
+
+    reference back() noexcept {
+        return (*this)[size_ - 1u];
+    }
+    const_reference back() const noexcept {
+        return (*this)[size_ - 1u];
+    }
+
+    // Returns the field `I` of all rows.
+    template <::std::size_t I>
+    ::std::span<column_type<I>> column() noexcept {
+        return {::std::get<I>(columns_), size_};
+    }
+    template <::std::size_t I>
+    ::std::span<column_type<I> const> column() const noexcept {
+        return {::std::get<I>(columns_), size_};
+    }
+
+    template <::std::size_t I>
+    column_type<I>* data() noexcept {
+        return ::std::get<I>(columns_);
+    }
+    template <::std::size_t I>
+    column_type<I> const* data() const noexcept {
+        return ::std::get<I>(columns_);
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0u;
+    }
+
+    size_type capacity() const noexcept {
+        return capacity_;
+    }
+
+    allocator_reference get_allocator() const noexcept {
+        return allocator_;
+    }
+
+    // Makes room for at least `count` rows.
+    void reserve(size_type count) noexcept {
+        if (count > capacity_)
+            reallocate(count);
+    }
+
+    // Moves the rows to memory that just fits them, or frees it if there are none.
+    void shrink_to_fit() noexcept {
+        if (size_ == capacity_)
+            return;
+        if (size_ == 0u)
+            release();
+        else
+            reallocate(size_);
+    }
+
+    void clear() noexcept {
+        for_each_column([this](auto* column) { ::std::destroy(column, column + size_); });
+        size_ = 0u;
+    }
+
+    // Value-initializes new rows or destroys those beyond `count`.
+    void resize(size_type count) noexcept
+        requires(meta::default_initializable<Ts> and ...)
+    {
+        if (count > size_) {
+            reserve_for(count);
+            for_each_column([this, count](auto* column) {
+                ranges::uninitialized_value_construct_n(
+                        column + size_, static_cast<difference_type>(count - size_));
+            });
+        } else {
+            for_each_column([this, count](auto* column) {
+                ::std::destroy(column + count, column + size_);
+            });
+        }
+        size_ = count;
+    }
+
+    // Constructs a row at the back, each field from one of the `values`.
+    template <typename... Us>
+        requires(sizeof...(Us) == sizeof...(Ts) and (meta::nothrow_constructible<Ts, Us> and ...))
+    reference emplace_back(Us&&... values) noexcept {
+        if (size_ == capacity_) [[unlikely]] {
+            // The `values` may refer to our fields, which are about to move.
+            value_type row{::std::forward<Us>(values)...};
+            reserve_for(size_ + 1u);
+            construct_row(size_, ::std::move(row), column_indices{});
+        } else {
+            construct_row(size_, ::std::forward_as_tuple(::std::forward<Us>(values)...),
+                          column_indices{});
+        }
+        return (*this)[size_++];
+    }
+
+    void push_back(value_type const& row) noexcept
+        requires(meta::copy_constructible<Ts> and ...)
+    {
+        ::std::apply([this](Ts const&... values) { emplace_back(values...); }, row);
+    }
+
+    void push_back(value_type&& row) noexcept {
+        ::std::apply([this](Ts&... values) { emplace_back(::std::move(values)...); }, row);
+    }
+
+    void pop_back() noexcept {
+        FLUX_ASSERT(!empty());
+        --size_;
+        for_each_column([this](auto* column) { ::std::destroy_at(column + size_); });
+    }
+
+    // Destroys the row at `index` and moves the rows that follow it down, so their order is kept.
+    void erase(size_type index) noexcept {
+        FLUX_ASSERT(index < size_);
+        for_each_column([this, index](auto* column) {
+            detail::close_gap(column + index, column + size_, 1u);
+        });
+        --size_;
+    }
+
+    // Destroys the row at `index` and moves the last row into its place.
+    void swap_erase(size_type index) noexcept {
+        FLUX_ASSERT(index < size_);
+        --size_;
+        for_each_column([this, index](auto* column) {
+            ::std::destroy_at(column + index);
+            if (index != size_)
+                relocate_at(column + size_, column + index);
+        });
+    }
+
+private:
+    template <typename F>
+    void for_each_column(F&& f) noexcept {
+        ::std::apply([&f](Ts*... columns) { (f(columns), ...); }, columns_);
+    }
+
+    template <typename Row, ::std::size_t... I>
+    void construct_row(size_type index, Row&& row, ::std::index_sequence<I...>) noexcept {
+        (::std::construct_at(::std::get<I>(columns_) + index,
+                             ::std::get<I>(::std::forward<Row>(row))),
+         ...);
+    }
+
+    // Allocators may not support the column alignment, the block is only aligned to this one.
+    static constexpr size_type block_alignment = detail::max_alignment;
+
+    // The columns follow each other, every one of them starts on a multiple of the alignment. The
+    // block has room to align the first one.
+    static constexpr size_type block_size(size_type capacity) noexcept {
+        size_type size = 0u;
+        ((size = (size + column_alignment - 1u) / column_alignment * column_alignment +
+                 capacity * sizeof(Ts)),
+         ...);
+        return size + column_alignment - block_alignment;
+    }
+
+    static columns_type carve(void* memory, size_type capacity) noexcept {
+        auto*        position = static_cast<::std::byte*>(memory);
+        columns_type columns;
+        ::std::apply(
+                [&position, capacity](Ts*&... column) {
+                    ((position += align_offset(position, column_alignment),
+                      column    = reinterpret_cast<Ts*>(position),
+                      position += capacity * sizeof(Ts)),
+                     ...);
+                },
+                columns);
+        return columns;
+    }
+
+    // Grows by half of the capacity at least, so that appending takes amortized constant time.
+    void reserve_for(size_type count) noexcept {
+        if (count > capacity_)
+            reallocate(::std::max(count, capacity_ + capacity_ / 2u));
+    }
+
+    // Relocates the rows to new memory for `capacity` rows, column by column.
+    void reallocate(size_type capacity) noexcept {
+        FLUX_ASSERT(capacity >= size_);
+        auto* const memory  = allocator_.allocate_node(block_size(capacity), block_alignment);
+        auto const  columns = carve(memory, capacity);
+
+        relocate_columns(columns, column_indices{});
+        release();
+        memory_   = memory;
+        columns_  = columns;
+        capacity_ = capacity;
+    }
+
+    template <::std::size_t... I>
+    void relocate_columns(columns_type const& columns, ::std::index_sequence<I...>) noexcept {
+        (ranges::uninitialized_relocate_no_overlap(::std::get<I>(columns_),
+                                                   ::std::get<I>(columns_) + size_,
+                                                   ::std::get<I>(columns)),
+         ...);
+    }
+
+    void copy_rows(basic_soa_vector const& other) noexcept {
+        reserve(other.size_);
+        copy_columns(other, column_indices{});
+        size_ = other.size_;
+    }
+
+    template <::std::size_t... I>
+    void copy_columns(basic_soa_vector const& other, ::std::index_sequence<I...>) noexcept {
+        (ranges::uninitialized_copy_no_overlap(::std::get<I>(other.columns_),
+                                               ::std::get<I>(other.columns_) + other.size_,
+                                               ::std::get<I>(columns_)),
+         ...);
+    }
+
+    // Frees the memory, the rows must have been destroyed or relocated.
+    void release() noexcept {
+        if (memory_) {
+            allocator_.deallocate_node(memory_, block_size(capacity_), block_alignment);
+            memory_   = nullptr;
+            columns_  = columns_type{};
+            capacity_ = 0u;
+        }
+    }
+
+    void*               memory_ = nullptr;
+    columns_type        columns_{};
+    size_type           size_     = 0u;
+    size_type           capacity_ = 0u;
+    allocator_reference allocator_;
+};
+
+// A struct of arrays with the fields `Ts...` from the `default_allocator`.
+template <typename... Ts>
+using soa_vector = basic_soa_vector<default_allocator, Ts...>;
+
+} // namespace flux::fou
@@ -0,0 +1,90 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstring>
+#include <string>
+#include <string_view>
+
+using namespace flux;
+using namespace flux::fou;
+
+TEST_CASE("fou::string_id", "[flux-containers/string_interner.hpp]") {
+    static_assert(sizeof(string_id) == 4u);
+
+    string_id const null;
+    CHECK(!null);
+    CHECK(string_id{0u});
+    CHECK(string_id{1u} < string_id{2u});
+}
+
+TEST_CASE("fou::string_interner", "[flux-containers/string_interner.hpp]") {
+    string_interner<> interner{256u};
+    CHECK(interner.empty());
+    CHECK(!interner.find("transform"));
+
+    auto const transform = interner.intern("transform");
+    auto const velocity  = interner.intern(::std::string{"velocity"});
+    CHECK(transform.index() == 0u);
+    CHECK(velocity.index() == 1u);
+    CHECK(interner.size() == 2u);
+
+    CHECK(interner.intern("transform") == transform);
+    CHECK(interner.find("velocity") == velocity);
+    CHECK(interner.contains("transform"));
+    CHECK(!interner.contains("transfor"));
+    CHECK(interner.size() == 2u);
+
+    CHECK(interner[transform] == "transform");
+    CHECK(::std::strcmp(interner[velocity].data(), "velocity") == 0);
+
+    SECTION("precomputed hash") {
+        static constexpr auto hash = string_interner<>::hash("velocity");
+        CHECK(hash == string_interner<>::hash(::std::string{"velocity"}));
+        CHECK(interner.find("velocity", hash) == velocity);
+        CHECK(interner.intern("velocity", hash) == velocity);
+    }
+    SECTION("empty string") {
+        auto const empty = interner.intern("");
+        CHECK(interner[empty].empty());
+        CHECK(interner.intern(::std::string_view{}) == empty);
+    }
+    SECTION("stable views") {
+        auto const view = interner[transform];
+        for (auto i = 0; i < 1000; ++i)
+            (void)interner.intern(::std::to_string(i));
+        CHECK(interner.size() == 1002u);
+        CHECK(interner[transform].data() == view.data());
+        for (auto i = 0; i < 1000; ++i)
+            CHECK(interner[interner.find(::std::to_string(i))] == ::std::to_string(i));
+    }
+    SECTION("larger than a block") {
+        ::std::string const large(4096u, 'x');
+        auto const          id = interner.intern(large);
+        CHECK(interner[id] == large);
+        CHECK(interner[id].data()[large.size()] == '\0');
+        CHECK(interner.intern(large) == id);
+        CHECK(interner[interner.intern("after")] == "after");
+        CHECK(interner[transform] == "transform");
+
+        interner.clear();
+        CHECK(!interner.find(large));
+        CHECK(interner[interner.intern(large)] == large);
+    }
+    SECTION("clear") {
+        interner.clear();
+        CHECK(interner.empty());
+        CHECK(!interner.find("transform"));
+        CHECK(interner.intern("velocity").index() == 0u);
+    }
+}
+
+TEST_CASE("fou::string_interner stateful", "[flux-containers/string_interner.hpp]") {
+    memory_stack<> stack{4096u};
+
+    string_interner<memory_stack<>> interner{1024u, stack};
+    auto const a = interner.intern("a");
+    auto const b = interner.intern("b");
+    CHECK(a != b);
+    CHECK(interner[b] == "b");
+}
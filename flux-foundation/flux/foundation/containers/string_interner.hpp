@@ -0,0 +1,252 @@
+#pragma once
+#include <flux/foundation/containers/dynamic_array.hpp>
+#include <flux/foundation/containers/flat_hash_set.hpp>
+#include <flux/foundation/memory/memory_stack.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace flux::fou {
+
+// Refers to a string of a `string_interner`, two ids of the same interner are equal if and only
+// if their strings are equal. Ids are dense and given in order of interning, starting at 0.
+class [[nodiscard]] string_id {
+public:
+    using index_type = ::std::uint32_t;
+
+    static constexpr index_type npos = UINT32_MAX;
+
+    // A null id, it never refers to a string.
+    constexpr string_id() noexcept = default;
+
+    constexpr explicit string_id(index_type index) noexcept : index_{index} {}
+
+    constexpr index_type index() const noexcept {
+        return index_;
+    }
+
+    constexpr explicit operator bool() const noexcept {
+        return index_ != npos;
+    }
+
+    constexpr auto operator<=>(string_id const&) const noexcept = default;
+
+private:
+    index_type index_ = npos;
+};
+
+namespace detail {
+
+// A string of a `string_interner` in its index, with its hash so that probing and growing the
+// index never hash the string again.
+struct [[nodiscard]] interned_string final {
+    char const*     data;
+    ::std::uint32_t size;
+    ::std::uint32_t index;
+    ::std::uint64_t hash;
+
+    ::std::string_view view() const noexcept {
+        return {data, size};
+    }
+};
+
+// A string to look up in the index of a `string_interner`, with its precomputed hash.
+struct [[nodiscard]] hashed_string final {
+    ::std::string_view view;
+    ::std::uint64_t    hash;
+};
+
+struct [[nodiscard]] interned_string_hash final {
+    using is_transparent = void;
+
+    ::std::uint64_t operator()(interned_string const& string) const noexcept {
+        return string.hash;
+    }
+    ::std::uint64_t operator()(hashed_string const& string) const noexcept {
+        return string.hash;
+    }
+};
+
+struct [[nodiscard]] interned_string_equal final {
+    using is_transparent = void;
+
+    bool operator()(interned_string const& lhs, interned_string const& rhs) const noexcept {
+        return lhs.hash == rhs.hash and lhs.view() == rhs.view();
+    }
+    bool operator()(hashed_string const& lhs, interned_string const& rhs) const noexcept {
+        return lhs.hash == rhs.hash and lhs.view == rhs.view();
+    }
+    bool operator()(interned_string const& lhs, hashed_string const& rhs) const noexcept {
+        return lhs.hash == rhs.hash and lhs.view() == rhs.view;
+    }
+};
+
+} // namespace detail
+
+// Maps strings to `string_id`s, so that names repeated all over a program, like asset paths,
+// component names or log categories, are stored once and compared as integers. The bytes are
+// copied into a `memory_stack` one after another, each followed by a null terminator, and never
+// move afterwards, so the views of interned strings stay valid until `clear()`. An open-addressing
+// index on the hash of the strings finds the id of a string, while an array indexed by the id
+// gives the view of a string in constant time without hashing. A string that doesn't fit a block
+// of the stack is allocated on its own from the `RawAllocator`.
+// NOTE:
+//  The hash of a string is `hash()`, it can be computed at compile time and passed to `intern()`
+//  and `find()` to skip hashing at runtime:
+//   static constexpr auto hash = string_interner<>::hash("transform");
+//   auto const id = interner.intern("transform", hash);
+template <raw_allocator RawAllocator = default_allocator>
+class [[nodiscard]] string_interner {
+    using allocator_reference = allocator_reference<RawAllocator>;
+    using string_type         = detail::interned_string;
+    using index_type          = flat_hash_set<string_type, detail::interned_string_hash,
+                                              detail::interned_string_equal, RawAllocator>;
+
+public:
+    using allocator_type  = typename allocator_reference::allocator_type;
+    using stack_type      = memory_stack<allocator_reference>;
+    using size_type       = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+
+    static constexpr size_type default_block_size = size_type{64u} << 10u;
+
+    string_interner() noexcept
+        requires(not is_stateful_allocator<allocator_type>::value)
+            : string_interner{default_block_size} {}
+
+    explicit string_interner(size_type block_size) noexcept
+        requires(not is_stateful_allocator<allocator_type>::value)
+            : string_interner{block_size, allocator_type{}} {}
+
+    // The bytes are copied into blocks of `block_size` bytes, the first one is allocated here.
+    string_interner(size_type block_size, allocator_reference allocator) noexcept
+            : bytes_{block_size, allocator}, strings_{allocator}, large_{allocator},
+              index_{allocator} {}
+
+    string_interner(string_interner&&) noexcept = default;
+
+    string_interner& operator=(string_interner&& other) noexcept {
+        if (this != &other) {
+            deallocate_large();
+            bytes_   = ::std::move(other.bytes_);
+            first_   = other.first_;
+            strings_ = ::std::move(other.strings_);
+            large_   = ::std::move(other.large_);
+            index_   = ::std::move(other.index_);
+        }
+        return *this;
+    }
+
+    ~string_interner() {
+        deallocate_large();
+    }
+
+    // Returns the 64-bit FNV-1a hash of the `string`.
+    static constexpr ::std::uint64_t hash(::std::string_view string) noexcept {
+        ::std::uint64_t result = 0xcbf2'9ce4'8422'2325u;
+        for (auto const c : string) {
+            result ^= static_cast<unsigned char>(c);
+            result *= 0x0000'0100'0000'01b3u;
+        }
+        return result;
+    }
+
+    // Returns the id of the `string`, copying it if it has not been interned yet.
+    string_id intern(::std::string_view string) noexcept {
+        return intern(string, hash(string));
+    }
+
+    // The `hash` must be `hash(string)`.
+    string_id intern(::std::string_view string, ::std::uint64_t hash) noexcept {
+        FLUX_ASSERT(hash == string_interner::hash(string));
+        if (auto const it = index_.find(detail::hashed_string{string, hash}); it != index_.end()) {
+            return string_id{it->index};
+        }
+        if (strings_.size() >= string_id::npos or string.size() > UINT32_MAX) [[unlikely]] {
+            fast_terminate();
+        }
+
+        auto const data = allocate(string.size() + 1u);
+        ::std::memcpy(data, string.data(), string.size());
+        data[string.size()] = '\0';
+
+        auto const index = static_cast<string_id::index_type>(strings_.size());
+        strings_.emplace_back(data, string.size());
+        index_.insert(string_type{data, static_cast<::std::uint32_t>(string.size()), index, hash});
+        return string_id{index};
+    }
+
+    // Returns the id of the `string`, or a null id if it has not been interned.
+    string_id find(::std::string_view string) const noexcept {
+        return find(string, hash(string));
+    }
+
+    // The `hash` must be `hash(string)`.
+    string_id find(::std::string_view string, ::std::uint64_t hash) const noexcept {
+        FLUX_ASSERT(hash == string_interner::hash(string));
+        auto const it = index_.find(detail::hashed_string{string, hash});
+        return it != index_.end() ? string_id{it->index} : string_id{};
+    }
+
+    bool contains(::std::string_view string) const noexcept {
+        return static_cast<bool>(find(string));
+    }
+
+    // Returns the string of the `id`, its `data()` is null-terminated.
+    ::std::string_view operator[](string_id id) const noexcept {
+        FLUX_ASSERT(id.index() < strings_.size());
+        return strings_[id.index()];
+    }
+
+    size_type size() const noexcept {
+        return strings_.size();
+    }
+
+    bool empty() const noexcept {
+        return strings_.empty();
+    }
+
+    // Forgets every string, their ids and views must not be used afterwards. The first block of
+    // bytes is kept.
+    void clear() noexcept {
+        index_.clear();
+        strings_.clear();
+        deallocate_large();
+        bytes_.unwind(first_);
+    }
+
+    stack_type const& bytes() const noexcept {
+        return bytes_;
+    }
+
+private:
+    // Returns `size` bytes on the stack, or on their own if they don't fit its next block.
+    char* allocate(size_type size) noexcept {
+        if (auto const memory = bytes_.try_allocate(size, 1u)) {
+            return static_cast<char*>(memory);
+        }
+        if (size + 2u * detail::debug_fence_size <= bytes_.next_capacity()) {
+            return static_cast<char*>(bytes_.allocate(size, 1u));
+        }
+        auto const data = static_cast<char*>(large_.get_allocator().allocate_node(size, 1u));
+        large_.emplace_back(data, size);
+        return data;
+    }
+
+    void deallocate_large() noexcept {
+        auto allocator = large_.get_allocator();
+        for (auto const string : large_) {
+            allocator.deallocate_node(const_cast<char*>(string.data()), string.size(), 1u);
+        }
+        large_.clear();
+    }
+
+    stack_type                                      bytes_;
+    typename stack_type::marker                     first_ = bytes_.top();
+    dynamic_array<::std::string_view, RawAllocator> strings_;
+    dynamic_array<::std::string_view, RawAllocator> large_;
+    index_type                                      index_;
+};
+
+} // namespace flux::fou
@@ -0,0 +1,5 @@
+#pragma once
+
+#include <flux/foundation/coroutine/frame_allocator.hpp>
+#include <flux/foundation/coroutine/generator.hpp>
+#include <flux/foundation/coroutine/task.hpp>
@@ -0,0 +1,66 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <thread>
+
+using namespace flux::fou;
+
+TEST_CASE("fou::coroutine_frame_allocator", "[flux-coroutine/frame_allocator.hpp]") {
+    auto& allocator = coroutine_frame_allocator::get();
+    CHECK(&allocator == &coroutine_frame_allocator::get());
+    auto const frames = allocator.frame_count();
+
+    SECTION("recycling") {
+        auto* first = allocator.allocate_node(200u, 16u);
+        CHECK(allocator.frame_count() == frames + 1u);
+        allocator.deallocate_node(first, 200u, 16u);
+        CHECK(allocator.frame_count() == frames);
+
+        // Frames of the same size class are reused.
+        auto* second = allocator.allocate_node(250u, 16u);
+        CHECK(second == first);
+        allocator.deallocate_node(second, 250u, 16u);
+
+        auto* big = allocator.allocate_node(coroutine_frame_allocator::max_frame_size + 1u, 16u);
+        CHECK(allocator.frame_count() == frames + 1u);
+        allocator.deallocate_node(big, coroutine_frame_allocator::max_frame_size + 1u, 16u);
+        CHECK(allocator.frame_count() == frames);
+    }
+    SECTION("remote deallocation") {
+        auto* frame = allocator.allocate_node(64u, 16u);
+        ::std::thread{[&] {
+            CHECK(&coroutine_frame_allocator::get() != &allocator);
+            allocator.deallocate_node(frame, 64u, 16u);
+        }}.join();
+        CHECK(allocator.frame_count() == frames);
+
+        // The next allocation takes the frame back from the other thread.
+        auto* again = allocator.allocate_node(64u, 16u);
+        CHECK(again == frame);
+        allocator.deallocate_node(again, 64u, 16u);
+    }
+    SECTION("thread exit") {
+        // The allocator of the thread lives until its last frame has been freed.
+        coroutine_frame_allocator* other = nullptr;
+        void*                      frame = nullptr;
+        ::std::thread{[&] {
+            other = &coroutine_frame_allocator::get();
+            frame = other->allocate_node(64u, 16u);
+        }}.join();
+        CHECK(other->frame_count() == 0u);
+        other->deallocate_node(frame, 64u, 16u);
+    }
+}
+
+TEST_CASE("fou::coroutine_frame", "[flux-coroutine/frame_allocator.hpp]") {
+    memory_stack<> stack{4096u};
+    auto const     top = stack.top();
+
+    // Any allocator can be referenced behind a frame.
+    auto* frame = detail::coroutine_frame::allocate(100u, stack);
+    CHECK(is_aligned(frame, detail::coroutine_frame::alignment));
+    CHECK(stack.top() > top);
+    detail::coroutine_frame::deallocate(frame, 100u);
+    stack.unwind(top);
+}
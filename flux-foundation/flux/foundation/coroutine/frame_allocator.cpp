@@ -0,0 +1,95 @@
+#include <flux/foundation/coroutine/frame_allocator.hpp>
+
+namespace flux::fou {
+
+namespace {
+
+thread_local coroutine_frame_allocator* current_allocator = nullptr;
+
+} // namespace
+
+namespace detail {
+
+// Releases the allocator of the thread on thread exit.
+struct [[nodiscard]] coroutine_frame_owner final {
+    ~coroutine_frame_owner() {
+        if (allocator) {
+            // Frames destroyed from now on take the remote path, even on this thread.
+            current_allocator = nullptr;
+            allocator->release();
+        }
+    }
+
+    coroutine_frame_allocator* allocator = nullptr;
+
+    static coroutine_frame_allocator* create() noexcept {
+        return new coroutine_frame_allocator{};
+    }
+};
+
+} // namespace detail
+
+coroutine_frame_allocator& coroutine_frame_allocator::get() noexcept {
+    if (!current_allocator) [[unlikely]] {
+        thread_local detail::coroutine_frame_owner owner;
+        FLUX_ASSERT(!owner.allocator);
+
+        owner.allocator   = detail::coroutine_frame_owner::create();
+        current_allocator = owner.allocator;
+    }
+    return *current_allocator;
+}
+
+coroutine_frame_allocator::coroutine_frame_allocator() noexcept
+        : pools_{max_frame_size, block_size} {}
+
+void* coroutine_frame_allocator::allocate_node(size_type size, size_type alignment) noexcept {
+    FLUX_ASSERT(this == current_allocator);
+    FLUX_ASSERT(alignment <= max_alignment());
+
+    references_.fetch_add(1u, ::std::memory_order_relaxed);
+    if (size > max_frame_size) {
+        default_allocator heap;
+        return allocator_traits<default_allocator>::allocate_node(heap, size, alignment);
+    }
+
+    if (remote_.load(::std::memory_order_relaxed)) [[unlikely]]
+        reclaim();
+    return pools_.allocate_node(size);
+}
+
+void coroutine_frame_allocator::deallocate_node(void* node, size_type size,
+                                                size_type alignment) noexcept {
+    if (size > max_frame_size) {
+        default_allocator heap;
+        allocator_traits<default_allocator>::deallocate_node(heap, node, size, alignment);
+    } else if (this == current_allocator) {
+        pools_.deallocate_node(node, size);
+    } else {
+        auto* frame = ::std::construct_at(static_cast<remote_frame*>(node), nullptr, size);
+        auto* head  = remote_.load(::std::memory_order_relaxed);
+        do {
+            frame->next = head;
+        } while (!remote_.compare_exchange_weak(head, frame, ::std::memory_order_release,
+                                                ::std::memory_order_relaxed));
+    }
+    release();
+}
+
+void coroutine_frame_allocator::reclaim() noexcept {
+    auto* frame = remote_.exchange(nullptr, ::std::memory_order_acquire);
+    while (frame) {
+        auto* next = frame->next;
+        pools_.deallocate_node(frame, frame->size);
+        frame = next;
+    }
+}
+
+void coroutine_frame_allocator::release() noexcept {
+    if (references_.fetch_sub(1u, ::std::memory_order_acq_rel) == 1u) {
+        reclaim();
+        delete this;
+    }
+}
+
+} // namespace flux::fou
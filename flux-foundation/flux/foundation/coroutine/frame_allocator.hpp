@@ -0,0 +1,153 @@
+#pragma once
+#include <flux/foundation/memory/default_allocator.hpp>
+#include <flux/foundation/memory/memory_arena.hpp>
+#include <flux/foundation/memory/memory_pool.hpp>
+#include <flux/foundation/memory/memory_pool_list.hpp>
+#include <flux/foundation/utility/addressof.hpp>
+#include <flux/foundation/utility/launder.hpp>
+
+#include <atomic>
+#include <coroutine>
+#include <memory>
+
+namespace flux::fou {
+
+namespace detail {
+
+struct [[nodiscard]] coroutine_frame_owner;
+
+} // namespace detail
+
+// A stateful `RawAllocator` for coroutine frames, there is one per thread. Frames are recycled by
+// size through a `memory_pool_list` with `log2_buckets`, so once a thread has run its coroutines
+// for a while, creating a coroutine doesn't allocate from the heap anymore. Frames bigger than
+// `max_frame_size` come from the heap.
+// A frame may be destroyed by another thread than the one that created it, e.g. when a coroutine
+// is resumed on a worker of a `job_system`. It is then pushed onto a lock-free list that the owning
+// thread returns to its pools on its next allocation. The allocator outlives its thread as long as
+// there are frames allocated from it.
+class [[nodiscard]] coroutine_frame_allocator {
+public:
+    using allocator_type  = coroutine_frame_allocator;
+    using size_type       = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+
+    static constexpr size_type max_frame_size = 4096u;
+    static constexpr size_type block_size     = 64u * 1024u;
+
+    // Returns the allocator of the calling thread, it is created on first use.
+    static coroutine_frame_allocator& get() noexcept;
+
+    coroutine_frame_allocator(coroutine_frame_allocator const&)            = delete;
+    coroutine_frame_allocator& operator=(coroutine_frame_allocator const&) = delete;
+
+    void* allocate_node(size_type size, size_type alignment) noexcept;
+
+    void deallocate_node(void* node, size_type size, size_type alignment) noexcept;
+
+    // Returns the number of frames that are currently allocated.
+    size_type frame_count() const noexcept {
+        // The thread owning the allocator holds one reference.
+        return references_.load(::std::memory_order_relaxed) - 1u;
+    }
+
+    size_type max_alignment() const noexcept {
+        return detail::max_alignment;
+    }
+
+private:
+    struct [[nodiscard]] remote_frame final {
+        remote_frame* next;
+        size_type     size;
+    };
+
+    coroutine_frame_allocator() noexcept;
+
+    ~coroutine_frame_allocator() = default;
+
+    // Returns the frames destroyed by other threads to the pools.
+    void reclaim() noexcept;
+
+    // Drops a reference, the allocator is deleted when it was the last one.
+    void release() noexcept;
+
+    memory_pool_list<node_pool, log2_buckets> pools_;
+    ::std::atomic<remote_frame*>              remote_{nullptr};
+    ::std::atomic<size_type>                  references_{1u};
+
+    friend detail::coroutine_frame_owner;
+};
+
+namespace detail {
+
+// The allocator of a coroutine frame is stored behind the frame together with the function that
+// returns the frame to it, so that `operator delete` finds it without a thread-local lookup.
+struct [[nodiscard]] coroutine_frame final {
+    using size_type = ::std::size_t;
+
+    static constexpr size_type alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+    static constexpr size_type offset(size_type size) noexcept {
+        constexpr auto trailer_alignment = alignof(coroutine_frame);
+        return (size + trailer_alignment - 1u) & ~(trailer_alignment - 1u);
+    }
+
+    static constexpr size_type total_size(size_type size) noexcept {
+        return offset(size) + sizeof(coroutine_frame);
+    }
+
+    template <raw_allocator RawAllocator>
+    static void* allocate(size_type size, RawAllocator& allocator) noexcept {
+        using traits = allocator_traits<RawAllocator>;
+
+        auto* frame = static_cast<::std::byte*>(
+                traits::allocate_node(allocator, total_size(size), alignment));
+        ::new (frame + offset(size)) coroutine_frame{
+                addressof(allocator), [](void* context, void* node, size_type node_size) noexcept {
+                    traits::deallocate_node(*static_cast<RawAllocator*>(context), node, node_size,
+                                            alignment);
+                }};
+        return frame;
+    }
+
+    static void deallocate(void* frame, size_type size) noexcept {
+        auto* bytes   = static_cast<::std::byte*>(frame);
+        auto& trailer = *launder(reinterpret_cast<coroutine_frame*>(bytes + offset(size)));
+        trailer.release(trailer.allocator, frame, total_size(size));
+    }
+
+    void* allocator;
+    void (*release)(void* allocator, void* node, size_type size) noexcept;
+};
+
+} // namespace detail
+
+// The base of promise types whose frames are allocated by the `coroutine_frame_allocator` of the
+// calling thread. A coroutine can use another allocator, e.g. a `memory_stack` for coroutines that
+// don't outlive a scope, by taking `::std::allocator_arg` and a reference to the allocator as its
+// first parameters, or as its first parameters after the object for member functions.
+struct [[nodiscard]] coroutine_promise_base {
+    using size_type = ::std::size_t;
+
+    static void* operator new(size_type size) {
+        return detail::coroutine_frame::allocate(size, coroutine_frame_allocator::get());
+    }
+
+    template <raw_allocator RawAllocator, typename... Args>
+    static void* operator new(size_type size, ::std::allocator_arg_t, RawAllocator& allocator,
+                              Args const&...) {
+        return detail::coroutine_frame::allocate(size, allocator);
+    }
+
+    template <typename Object, raw_allocator RawAllocator, typename... Args>
+    static void* operator new(size_type size, Object const&, ::std::allocator_arg_t,
+                              RawAllocator& allocator, Args const&...) {
+        return detail::coroutine_frame::allocate(size, allocator);
+    }
+
+    static void operator delete(void* frame, size_type size) noexcept {
+        detail::coroutine_frame::deallocate(frame, size);
+    }
+};
+
+} // namespace flux::fou
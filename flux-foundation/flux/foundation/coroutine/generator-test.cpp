@@ -0,0 +1,50 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+using namespace flux::fou;
+
+namespace {
+
+generator<int> iota(int count) {
+    for (auto i = 0; i < count; ++i)
+        co_yield i;
+}
+
+generator<int&> elements(int* first, int* last) {
+    for (; first != last; ++first)
+        co_yield *first;
+}
+
+} // namespace
+
+TEST_CASE("fou::generator", "[flux-coroutine/generator.hpp]") {
+    auto&      allocator = coroutine_frame_allocator::get();
+    auto const frames    = allocator.frame_count();
+
+    SECTION("values") {
+        auto sum = 0;
+        for (auto i : iota(5))
+            sum += i;
+        CHECK(sum == 10);
+
+        for ([[maybe_unused]] auto i : iota(0))
+            FAIL();
+    }
+    SECTION("references") {
+        int values[] = {1, 2, 3};
+        for (auto& value : elements(values, values + 3))
+            value *= 2;
+        CHECK(values[0] == 2);
+        CHECK(values[2] == 6);
+    }
+    SECTION("early destruction") {
+        auto g  = iota(100);
+        auto it = g.begin();
+        CHECK(*it == 0);
+        ++it;
+        CHECK(*it == 1);
+        CHECK(allocator.frame_count() == frames + 1u);
+    }
+    CHECK(allocator.frame_count() == frames);
+}
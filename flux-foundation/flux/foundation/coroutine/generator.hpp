@@ -0,0 +1,137 @@
+#pragma once
+#include <flux/foundation/coroutine/frame_allocator.hpp>
+#include <flux/foundation/utility/addressof.hpp>
+#include <flux/foundation/utility/terminate.hpp>
+
+#include <iterator>
+#include <type_traits>
+
+namespace flux::fou {
+
+// A coroutine that lazily produces a sequence of `T` with `co_yield`, it is an input range.
+// A yielded value is referenced and not copied, it is valid until the generator is resumed.
+// The frame is allocated like the one of a `task`, see `coroutine_promise_base`.
+// NOTE:
+//  A generator cannot `co_await`, and there are no exceptions, so an exception escaping the
+//  coroutine terminates the program.
+template <typename T>
+class [[nodiscard]] generator {
+public:
+    using value_type = ::std::remove_cvref_t<T>;
+    using reference  = ::std::conditional_t<::std::is_reference_v<T>, T, T const&>;
+    using pointer    = ::std::add_pointer_t<reference>;
+
+    struct [[nodiscard]] promise_type final : coroutine_promise_base {
+        generator get_return_object() noexcept {
+            return generator{::std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        ::std::suspend_always initial_suspend() const noexcept {
+            return {};
+        }
+
+        ::std::suspend_always final_suspend() const noexcept {
+            return {};
+        }
+
+        ::std::suspend_always yield_value(::std::remove_reference_t<reference>& value) noexcept {
+            value_ = addressof(value);
+            return {};
+        }
+
+        ::std::suspend_always yield_value(::std::remove_reference_t<reference>&& value) noexcept
+            requires(not ::std::is_lvalue_reference_v<T>)
+        {
+            value_ = addressof(value);
+            return {};
+        }
+
+        template <typename U>
+        void await_transform(U&&) = delete;
+
+        void return_void() const noexcept {}
+
+        void unhandled_exception() const noexcept {
+            fast_terminate();
+        }
+
+        pointer value_ = nullptr;
+    };
+
+    using handle_type = ::std::coroutine_handle<promise_type>;
+
+    struct [[nodiscard]] sentinel final {};
+
+    class [[nodiscard]] iterator {
+    public:
+        using iterator_concept = ::std::input_iterator_tag;
+        using value_type       = generator::value_type;
+        using difference_type  = ::std::ptrdiff_t;
+        using reference        = generator::reference;
+
+        iterator() noexcept = default;
+
+        explicit iterator(handle_type handle) noexcept : handle_{handle} {}
+
+        reference operator*() const noexcept {
+            FLUX_ASSERT(!handle_.done());
+            return static_cast<reference>(*handle_.promise().value_);
+        }
+
+        iterator& operator++() noexcept {
+            FLUX_ASSERT(!handle_.done());
+            handle_.resume();
+            return *this;
+        }
+
+        void operator++(int) noexcept {
+            ++*this;
+        }
+
+        friend bool operator==(iterator const& it, sentinel) noexcept {
+            return !it.handle_ || it.handle_.done();
+        }
+
+    private:
+        handle_type handle_ = nullptr;
+    };
+
+    generator() noexcept = default;
+
+    explicit generator(handle_type handle) noexcept : handle_{handle} {}
+
+    generator(generator&& other) noexcept : handle_{::std::exchange(other.handle_, nullptr)} {}
+
+    generator& operator=(generator&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            handle_ = ::std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    ~generator() {
+        destroy();
+    }
+
+    // Runs the coroutine up to the first value, it must only be called once.
+    iterator begin() noexcept {
+        if (handle_)
+            handle_.resume();
+        return iterator{handle_};
+    }
+
+    sentinel end() const noexcept {
+        return {};
+    }
+
+private:
+    void destroy() noexcept {
+        if (handle_)
+            handle_.destroy();
+    }
+
+    handle_type handle_ = nullptr;
+};
+
+} // namespace flux::fou
@@ -0,0 +1,125 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+using namespace flux::fou;
+
+namespace {
+
+task<int> value(int i) {
+    co_return i;
+}
+
+task<int> sum(int count) {
+    auto result = 0;
+    for (auto i = 0; i < count; ++i)
+        result += co_await value(i);
+    co_return result;
+}
+
+task<int&> reference(int& i) {
+    co_return i;
+}
+
+struct [[nodiscard]] move_only_value final {
+    explicit move_only_value(int v) noexcept : value{v} {}
+
+    move_only_value(move_only_value&&) noexcept            = default;
+    move_only_value& operator=(move_only_value&&) noexcept = default;
+
+    int value;
+};
+
+task<move_only_value> move_only() {
+    co_return move_only_value{42};
+}
+
+// Suspends until it is resumed from outside, like a coroutine waiting for I/O.
+struct [[nodiscard]] event final {
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    void await_suspend(::std::coroutine_handle<>) noexcept {
+        ++suspended;
+    }
+
+    void await_resume() const noexcept {}
+
+    int suspended = 0;
+};
+
+task<> wait_twice(event& e, int& steps) {
+    co_await e;
+    ++steps;
+    co_await e;
+    ++steps;
+}
+
+task<int> stacked(::std::allocator_arg_t, memory_stack<>&, int i) {
+    co_return co_await value(i) * 2;
+}
+
+task<int> deep(int depth) {
+    if (depth == 0)
+        co_return 0;
+    co_return co_await deep(depth - 1) + 1;
+}
+
+} // namespace
+
+TEST_CASE("fou::task", "[flux-coroutine/task.hpp]") {
+    auto&      allocator = coroutine_frame_allocator::get();
+    auto const frames    = allocator.frame_count();
+
+    SECTION("values") {
+        auto t = sum(10);
+        CHECK_FALSE(t.is_done());
+        CHECK(allocator.frame_count() == frames + 1u);
+        t.resume();
+        CHECK(t.is_done());
+        CHECK(t.result() == 45);
+
+        int  i = 1;
+        auto r = reference(i);
+        r.resume();
+        CHECK(&r.result() == &i);
+
+        auto m = move_only();
+        m.resume();
+        auto v = ::std::move(m).result();
+        CHECK(v.value == 42);
+    }
+    SECTION("suspension") {
+        event e;
+        int   steps = 0;
+        auto  t     = wait_twice(e, steps);
+        t.resume();
+        CHECK(e.suspended == 1);
+        CHECK(steps == 0);
+        t.resume();
+        CHECK(steps == 1);
+        CHECK_FALSE(t.is_done());
+        t.resume();
+        CHECK(steps == 2);
+        CHECK(t.is_done());
+    }
+    SECTION("symmetric transfer") {
+        auto t = deep(10000);
+        t.resume();
+        CHECK(t.result() == 10000);
+    }
+    SECTION("allocator") {
+        memory_stack<> stack{4096u};
+        auto const     top = stack.top();
+        {
+            auto t = stacked(::std::allocator_arg, stack, 21);
+            CHECK(stack.top() > top);
+            CHECK(allocator.frame_count() == frames);
+            t.resume();
+            CHECK(t.result() == 42);
+        }
+        stack.unwind(top);
+    }
+    CHECK(allocator.frame_count() == frames);
+}
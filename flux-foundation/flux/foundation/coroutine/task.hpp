@@ -0,0 +1,222 @@
+#pragma once
+#include <flux/foundation/coroutine/frame_allocator.hpp>
+#include <flux/foundation/memory/uninitialized_storage.hpp>
+#include <flux/foundation/utility/addressof.hpp>
+#include <flux/foundation/utility/terminate.hpp>
+
+#include <type_traits>
+
+namespace flux::fou {
+
+template <typename T = void>
+class [[nodiscard]] task;
+
+namespace detail {
+
+struct [[nodiscard]] task_promise_base : coroutine_promise_base {
+    struct [[nodiscard]] final_awaiter final {
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        // Transfers to the awaiting coroutine without growing the stack, so that long chains of
+        // tasks awaiting each other don't overflow it.
+        template <typename Promise>
+        ::std::coroutine_handle<> await_suspend(::std::coroutine_handle<Promise> handle) noexcept {
+            if (auto continuation = handle.promise().continuation)
+                return continuation;
+            return ::std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    ::std::suspend_always initial_suspend() const noexcept {
+        return {};
+    }
+
+    final_awaiter final_suspend() const noexcept {
+        return {};
+    }
+
+    void unhandled_exception() const noexcept {
+        fast_terminate();
+    }
+
+    ::std::coroutine_handle<> continuation;
+};
+
+template <typename T>
+struct [[nodiscard]] task_promise final : task_promise_base {
+    task_promise() noexcept = default;
+
+    ~task_promise() {
+        if (has_value_)
+            ::std::destroy_at(value_.data());
+    }
+
+    task_promise(task_promise const&)            = delete;
+    task_promise& operator=(task_promise const&) = delete;
+
+    task<T> get_return_object() noexcept;
+
+    template <typename U>
+        requires meta::constructible<T, U>
+    void return_value(U&& value) noexcept(meta::nothrow_constructible<T, U>) {
+        ::std::construct_at(value_.data(), ::std::forward<U>(value));
+        has_value_ = true;
+    }
+
+    T& value() noexcept {
+        FLUX_ASSERT(has_value_);
+        return *value_.data();
+    }
+
+private:
+    uninitialized_storage<T> value_;
+    bool                     has_value_ = false;
+};
+
+template <typename T>
+struct [[nodiscard]] task_promise<T&> final : task_promise_base {
+    task<T&> get_return_object() noexcept;
+
+    void return_value(T& value) noexcept {
+        value_ = addressof(value);
+    }
+
+    T& value() noexcept {
+        FLUX_ASSERT(value_);
+        return *value_;
+    }
+
+private:
+    T* value_ = nullptr;
+};
+
+template <>
+struct [[nodiscard]] task_promise<void> final : task_promise_base {
+    task<void> get_return_object() noexcept;
+
+    void return_void() const noexcept {}
+
+    void value() const noexcept {}
+};
+
+} // namespace detail
+
+// A lazily started coroutine producing a `T`. The coroutine starts when the task is awaited, and
+// the awaiting coroutine is resumed when it has finished. A task can also be driven from outside
+// of a coroutine, e.g. from a job or from the game loop, with `resume()`.
+// The frame is allocated by the `coroutine_frame_allocator` of the calling thread, unless the
+// coroutine takes `::std::allocator_arg` followed by an allocator, see `coroutine_promise_base`.
+// NOTE:
+//  There are no exceptions, so an exception escaping the coroutine terminates the program.
+template <typename T>
+class [[nodiscard]] task {
+public:
+    using promise_type = detail::task_promise<T>;
+    using handle_type  = ::std::coroutine_handle<promise_type>;
+
+    task() noexcept = default;
+
+    explicit task(handle_type handle) noexcept : handle_{handle} {}
+
+    task(task&& other) noexcept : handle_{::std::exchange(other.handle_, nullptr)} {}
+
+    task& operator=(task&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            handle_ = ::std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    ~task() {
+        destroy();
+    }
+
+    explicit operator bool() const noexcept {
+        return static_cast<bool>(handle_);
+    }
+
+    bool is_done() const noexcept {
+        return !handle_ || handle_.done();
+    }
+
+    // Starts the coroutine or resumes it from its current suspension point.
+    void resume() const noexcept {
+        FLUX_ASSERT(!is_done());
+        handle_.resume();
+    }
+
+    // Returns the result of the finished coroutine.
+    decltype(auto) result() & noexcept {
+        FLUX_ASSERT(handle_.done());
+        return handle_.promise().value();
+    }
+
+    decltype(auto) result() && noexcept {
+        FLUX_ASSERT(handle_.done());
+        if constexpr (::std::is_void_v<T> || ::std::is_reference_v<T>)
+            return handle_.promise().value();
+        else
+            return ::std::move(handle_.promise().value());
+    }
+
+    auto operator co_await() && noexcept {
+        return awaiter{handle_};
+    }
+
+    auto operator co_await() & noexcept {
+        return awaiter{handle_};
+    }
+
+private:
+    struct [[nodiscard]] awaiter final {
+        bool await_ready() const noexcept {
+            return handle.done();
+        }
+
+        ::std::coroutine_handle<> await_suspend(::std::coroutine_handle<> awaiting) const noexcept {
+            handle.promise().continuation = awaiting;
+            return handle;
+        }
+
+        decltype(auto) await_resume() const noexcept {
+            if constexpr (::std::is_void_v<T> || ::std::is_reference_v<T>)
+                return handle.promise().value();
+            else
+                return ::std::move(handle.promise().value());
+        }
+
+        handle_type handle;
+    };
+
+    void destroy() noexcept {
+        if (handle_)
+            handle_.destroy();
+    }
+
+    handle_type handle_ = nullptr;
+};
+
+namespace detail {
+
+template <typename T>
+task<T> task_promise<T>::get_return_object() noexcept {
+    return task<T>{::std::coroutine_handle<task_promise>::from_promise(*this)};
+}
+
+template <typename T>
+task<T&> task_promise<T&>::get_return_object() noexcept {
+    return task<T&>{::std::coroutine_handle<task_promise>::from_promise(*this)};
+}
+
+inline task<void> task_promise<void>::get_return_object() noexcept {
+    return task<void>{::std::coroutine_handle<task_promise>::from_promise(*this)};
+}
+
+} // namespace detail
+
+} // namespace flux::fou
@@ -8,9 +8,14 @@
 #include <flux/foundation/memory/deleter.hpp>
 #include <flux/foundation/memory/memory_arena.hpp>
 #include <flux/foundation/memory/memory_block.hpp>
+#include <flux/foundation/memory/memory_block_depot.hpp>
 #include <flux/foundation/memory/memory_pool.hpp>
 #include <flux/foundation/memory/memory_pool_list.hpp>
+#include <flux/foundation/memory/memory_pressure_monitor.hpp>
+#include <flux/foundation/memory/memory_resource_adapter.hpp>
 #include <flux/foundation/memory/memory_stack.hpp>
+#include <flux/foundation/memory/object_arena.hpp>
+#include <flux/foundation/memory/sharded_allocator.hpp>
 #include <flux/foundation/memory/static_allocator.hpp>
 #include <flux/foundation/memory/std_allocator_adapter.hpp>
 #include <flux/foundation/memory/temporary_allocator.hpp>
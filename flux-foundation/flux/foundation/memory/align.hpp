@@ -12,6 +12,11 @@ namespace detail {
 inline constexpr auto max_alignment = alignof(::std::max_align_t);
 } // namespace detail
 
+// The size that keeps two atomics from sharing a cache line, so that they are not invalidated by
+// each other's writes. `std::hardware_destructive_interference_size` is not reliable across
+// compilers, 128 bytes also covers the adjacent line prefetcher of current x86 CPUs.
+inline constexpr ::std::size_t cache_line_size = 128u;
+
 // clang-format off
 template <meta::integral I>
 constexpr bool is_pow2(I value) noexcept {
@@ -0,0 +1,56 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+
+using namespace flux::fou;
+
+namespace {
+
+constexpr ::std::size_t count     = 1000u;
+constexpr ::std::size_t node_size = 32u;
+
+// Allocates `count` nodes through the `reference` and frees them again.
+template <typename Reference>
+void churn(Reference& reference) {
+    void* nodes[count];
+    for (auto& node : nodes)
+        node = reference.allocate_node(node_size, alignof(::std::max_align_t));
+    for (auto* node : nodes)
+        reference.deallocate_node(node, node_size, alignof(::std::max_align_t));
+}
+
+// Compares a direct `allocator_reference` with an `any_allocator_reference` to the same
+// `allocator`, the limits are queried as often as the nodes are allocated and never hoisted out of
+// the loop.
+template <typename RawAllocator>
+void benchmark_references(char const* name, RawAllocator& allocator) {
+    allocator_reference<RawAllocator> direct(allocator);
+    any_allocator_reference           erased(allocator);
+
+    BENCHMARK(::std::string{name} + ", allocator_reference") {
+        churn(direct);
+    };
+    BENCHMARK(::std::string{name} + ", any_allocator_reference") {
+        churn(erased);
+    };
+    BENCHMARK(::std::string{name} + " limits, allocator_reference") {
+        for (::std::size_t i = 0u; i < count; ++i)
+            Catch::Benchmark::deoptimize_value(direct.max_node_size());
+    };
+    BENCHMARK(::std::string{name} + " limits, any_allocator_reference") {
+        for (::std::size_t i = 0u; i < count; ++i)
+            Catch::Benchmark::deoptimize_value(erased.max_node_size());
+    };
+}
+
+} // namespace
+
+TEST_CASE("fou::any_allocator_reference", "[flux-memory/allocator_storage.hpp]") {
+    memory_pool<> pool{node_size, memory_pool<>::min_block_size(node_size, count)};
+    benchmark_references("memory_pool", pool);
+
+    heap_allocator heap;
+    benchmark_references("heap_allocator", heap);
+}
@@ -2,7 +2,11 @@
 #include <flux/foundation/memory/detail/test_allocator.hpp>
 
 #include <catch2/catch.hpp>
+
+#include <atomic>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 namespace {
 
@@ -36,6 +40,28 @@ struct stub_allocator {
     }
 };
 
+// A stateless, thread-safe allocator that counts the calls that reach it.
+struct counting_allocator {
+    using size_type       = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+
+    static inline ::std::atomic<::std::size_t> allocations   = 0u;
+    static inline ::std::atomic<::std::size_t> deallocations = 0u;
+
+    void* allocate_node(size_type size, size_type) noexcept {
+        ++allocations;
+        return ::std::malloc(size);
+    }
+    void deallocate_node(void* node, size_type, size_type) noexcept {
+        ++deallocations;
+        ::std::free(node);
+    }
+
+    size_type max_node_size() const noexcept {
+        return 1024u;
+    }
+};
+
 template <typename Allocator>
 void check_allocate_node(flux::fou::allocator_reference<Allocator> ref) {
     auto const size  = sizeof(int);
@@ -259,4 +285,64 @@ TEST_CASE("fou::allocator_storage", "[flux-memory/allocator_storage.hpp]") {
         auto& result = ref.allocator();
         CHECK_FALSE(result.try_allocate_node(1, 1));
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("fou::any_allocator_reference", "[flux-memory/allocator_storage.hpp]") {
+    using namespace flux;
+
+    SECTION("cached limits") {
+        counting_allocator           allocator;
+        fou::any_allocator_reference ref(allocator);
+        CHECK(ref.max_node_size() == 1024u);
+        CHECK(ref.max_array_size() == 1024u);
+        CHECK(ref.max_alignment() == fou::detail::max_alignment);
+    }
+
+    SECTION("every call reaches the allocator") {
+        counting_allocator::allocations   = 0u;
+        counting_allocator::deallocations = 0u;
+
+        counting_allocator           allocator;
+        fou::any_allocator_reference ref(allocator);
+        for (int i = 0; i < 10; ++i) {
+            auto* node = ref.allocate_node(32u, 8u);
+            ref.deallocate_node(node, 32u, 8u);
+        }
+        CHECK(counting_allocator::allocations == 10u);
+        CHECK(counting_allocator::deallocations == 10u);
+    }
+
+    SECTION("concurrent use") {
+        counting_allocator::allocations   = 0u;
+        counting_allocator::deallocations = 0u;
+
+        // A reference to a thread-safe allocator can be shared by threads, it keeps no state
+        // besides the allocator. Each thread writes its nodes, so a node handed out twice shows
+        // up as corrupted.
+        constexpr ::std::size_t thread_count = 8u;
+        constexpr ::std::size_t iterations   = 1000u;
+
+        counting_allocator           allocator;
+        fou::any_allocator_reference ref(allocator);
+        ::std::vector<::std::size_t> corrupted(thread_count);
+        ::std::vector<::std::thread> threads;
+        for (::std::size_t t = 0u; t < thread_count; ++t) {
+            threads.emplace_back([&, t] {
+                for (::std::size_t i = 0u; i < iterations; ++i) {
+                    auto* node = static_cast<::std::size_t*>(ref.allocate_node(32u, 8u));
+                    *node      = t;
+                    ::std::this_thread::yield();
+                    corrupted[t] += *node != t;
+                    ref.deallocate_node(node, 32u, 8u);
+                }
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        CHECK(counting_allocator::allocations == thread_count * iterations);
+        CHECK(counting_allocator::deallocations == thread_count * iterations);
+        for (auto count : corrupted)
+            CHECK(count == 0u);
+    }
+}
@@ -78,6 +78,26 @@ public:
         allocator_traits::deallocate_array(alloc, ptr, count, size, alignment);
     }
 
+    constexpr memory_block allocate_at_least(size_type size, size_type alignment) noexcept {
+        lock_guard_t<storage_mutex> guard{*this};
+        auto&&                      alloc = allocator();
+        return allocator_traits::allocate_at_least(alloc, size, alignment);
+    }
+
+    constexpr bool try_expand(void* ptr, size_type size, size_type new_size,
+                              size_type alignment) noexcept {
+        lock_guard_t<storage_mutex> guard{*this};
+        auto&&                      alloc = allocator();
+        return allocator_traits::try_expand(alloc, ptr, size, new_size, alignment);
+    }
+
+    constexpr void* try_reallocate(void* ptr, size_type size, size_type new_size,
+                                   size_type alignment) noexcept {
+        lock_guard_t<storage_mutex> guard{*this};
+        auto&&                      alloc = allocator();
+        return allocator_traits::try_reallocate(alloc, ptr, size, new_size, alignment);
+    }
+
     constexpr auto try_allocate_node(size_type size, size_type alignment) noexcept
         requires composable_allocator<allocator_type>
     {
@@ -363,22 +383,31 @@ template <> class [[nodiscard]] reference_storage<any_allocator> {
 
         constexpr virtual ~allocator_concept() = default;
 
+        // The limits are queried once, when the allocator is wrapped.
         constexpr size_type max_node_size() const noexcept {
-            return max_size(query_type::node);
+            return limits_.node;
         }
 
         constexpr size_type max_array_size() const noexcept {
-            return max_size(query_type::array);
+            return limits_.array;
         }
 
         constexpr size_type max_alignment() const noexcept {
-            return max_size(query_type::alignment);
+            return limits_.alignment;
         }
 
     protected:
-        enum class query_type : ::std::uint8_t { node, array, alignment };
+        struct [[nodiscard]] limits final {
+            size_type node;
+            size_type array;
+            size_type alignment;
+        };
+
+        constexpr explicit allocator_concept(limits allocator_limits) noexcept
+                : limits_{allocator_limits} {}
 
-        virtual constexpr size_type max_size(query_type) const noexcept = 0;
+    private:
+        limits limits_;
     };
     // clang-format on
 
@@ -394,9 +423,11 @@ template <> class [[nodiscard]] reference_storage<any_allocator> {
         using allocator_type    = typename allocator_traits::allocator_type;
         using storage           = reference_storage_base<RawAllocator>;
 
-        constexpr explicit wrapper(RawAllocator& allocator) noexcept : storage{allocator} {}
+        constexpr explicit wrapper(RawAllocator& allocator) noexcept
+                : allocator_concept{limits_of(allocator)}, storage{allocator} {}
 
-        constexpr explicit wrapper(RawAllocator const& allocator) noexcept : storage{allocator} {}
+        constexpr explicit wrapper(RawAllocator const& allocator) noexcept
+                : allocator_concept{limits_of(allocator)}, storage{allocator} {}
 
         constexpr void clone(void* storage) const noexcept override {
             detail::construct_at(static_cast<wrapper*>(storage), allocator());
@@ -457,13 +488,10 @@ template <> class [[nodiscard]] reference_storage<any_allocator> {
             return is_composable_allocator<allocator_type>;
         }
 
-        constexpr size_type max_size(query_type type) const noexcept override {
-            auto&& alloc = allocator();
-            if (query_type::node == type)
-                return allocator_traits::max_node_size(alloc);
-            else if (query_type::array == type)
-                return allocator_traits::max_array_size(alloc);
-            return allocator_traits::max_alignment(alloc);
+        static constexpr limits limits_of(RawAllocator const& allocator) noexcept {
+            return {allocator_traits::max_node_size(allocator),
+                    allocator_traits::max_array_size(allocator),
+                    allocator_traits::max_alignment(allocator)};
         }
 
         constexpr allocator_type& allocator() const noexcept {
@@ -485,7 +513,7 @@ public:
                       "requires all instantiations to have certain maximum size");
         detail::construct_at(
                 reinterpret_cast<wrapper<meta::remove_cvref_t<RawAllocator>>*>(storage_),
-                          ::std::forward<meta::remove_cvref_t<RawAllocator>>  (allocator));
+                ::std::forward<RawAllocator>(allocator));
     }
 
     template <raw_allocator RawAllocator>
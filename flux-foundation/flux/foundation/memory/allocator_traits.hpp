@@ -1,5 +1,6 @@
 #pragma once
 #include <flux/foundation/memory/align.hpp>
+#include <flux/foundation/memory/memory_block.hpp>
 
 namespace flux::fou {
 
@@ -126,6 +127,24 @@ concept has_max_alignment =
         { allocator.max_alignment() } noexcept -> meta::integer;
     };
 
+template <typename Allocator>
+concept has_allocate_at_least =
+    requires(Allocator&& allocator, ::std::size_t size, ::std::size_t align) {
+        { allocator.allocate_at_least(size, align) } noexcept -> meta::same_as<memory_block>;
+    };
+
+template <typename Allocator>
+concept has_try_expand =
+    requires(Allocator&& allocator, void* ptr, ::std::size_t size, ::std::size_t align) {
+        { allocator.try_expand(ptr, size, size, align) } noexcept -> meta::same_as<bool>;
+    };
+
+template <typename Allocator>
+concept has_try_reallocate =
+    requires(Allocator&& allocator, void* ptr, ::std::size_t size, ::std::size_t align) {
+        { allocator.try_reallocate(ptr, size, size, align) } noexcept -> meta::same_as<void*>;
+    };
+
 template <typename Allocator>
 constexpr auto is_stateful() noexcept {
     if constexpr (requires { typename Allocator::stateful; }) {
@@ -216,6 +235,54 @@ struct [[nodiscard]] allocator_traits final {
             deallocate_node(allocator, array, count * size, alignment);
     }
 
+    // Allocates a node of at least `size` bytes and returns it with its actual size, all of it
+    // can be used and the actual size must be given back to `deallocate_node()`.
+    static constexpr memory_block
+    allocate_at_least(allocator_type& allocator,
+                      size_type       size     ,
+                      size_type       alignment) noexcept
+    {
+        if constexpr (detail::has_allocate_at_least<allocator_type>)
+            return allocator.allocate_at_least(size, alignment);
+        else
+            return {allocate_node(allocator, size, alignment), size};
+    }
+
+    // Grows the `node` from `size` to `new_size` bytes without moving it. Returns `false` if the
+    // allocator cannot do so, the `node` keeps its `size` then.
+    static constexpr bool
+    try_expand(allocator_type& allocator,
+               void*           node     ,
+               size_type       size     ,
+               size_type       new_size ,
+               size_type       alignment) noexcept
+    {
+        if constexpr (detail::has_try_expand<allocator_type>) {
+            return allocator.try_expand(node, size, new_size, alignment);
+        } else {
+            (void)allocator, (void)node, (void)size, (void)new_size, (void)alignment;
+            return false;
+        }
+    }
+
+    // Resizes the `node` from `size` to `new_size` bytes and copies its bytes if it has to be
+    // moved, like `realloc()`. Returns `nullptr` if the allocator cannot do so, the `node` is left
+    // untouched then.
+    static constexpr void*
+    try_reallocate(allocator_type& allocator,
+                   void*           node     ,
+                   size_type       size     ,
+                   size_type       new_size ,
+                   size_type       alignment) noexcept
+    {
+        if constexpr (detail::has_try_reallocate<allocator_type>) {
+            return allocator.try_reallocate(node, size, new_size, alignment);
+        } else {
+            (void)allocator, (void)node, (void)size, (void)new_size, (void)alignment;
+            return nullptr;
+        }
+    }
+
     static constexpr size_type max_node_size(allocator_type const& allocator) noexcept {
         if constexpr (detail::has_max_node_size<allocator_type>)
             return allocator.max_node_size();
@@ -129,6 +129,39 @@ constexpr auto constexpr_memmove(T* dest, U const* src, ::std::size_t count = 1)
     }
     return dest;
 }
+
+// Relocates `count` trivially relocatable objects from `src` to the uninitialized storage at
+// `dest`, the ranges may overlap. The lifetime of the objects at `src` ends.
+// NOTE:
+//  Bytes cannot be copied into objects that are not trivially copyable during constant
+//  evaluation, so they are move-constructed and destroyed one by one instead.
+template <typename T>
+    requires meta::trivially_relocatable<T>
+constexpr T* constexpr_relocate(T* dest, T* src, ::std::size_t count = 1) noexcept {
+    if constexpr (meta::trivially_copyable<T>) {
+        return constexpr_memmove(dest, src, count);
+    } else {
+        if consteval {
+            if (is_pointer_in_range(src, src + count, dest)) {
+                for (; count > 0; --count) {
+                    detail::construct_at(dest + count - 1, ::std::move(src[count - 1]));
+                    detail::destroy_at(src + count - 1);
+                }
+            } else {
+                for (::std::size_t i = 0; i != count; ++i) {
+                    detail::construct_at(dest + i, ::std::move(src[i]));
+                    detail::destroy_at(src + i);
+                }
+            }
+        } else {
+            if (count > 0) {
+                __builtin_memmove(static_cast<void*>(dest), static_cast<void const*>(src),
+                                  (count - 1) * sizeof(T) + meta::data_size_of<T>);
+            }
+        }
+        return dest;
+    }
+}
 // clang-format on
 
 } // namespace flux::fou::detail
\ No newline at end of file
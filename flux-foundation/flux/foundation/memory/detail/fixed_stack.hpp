@@ -63,6 +63,23 @@ struct [[nodiscard]] fixed_stack final {
         return memory;
     }
 
+    // Grows `memory`, the last allocation of `size` bytes, to `new_size` bytes if it still fits
+    // before `end`.
+    constexpr bool try_expand(::std::byte const* end, void* memory, ::std::size_t size,
+                              ::std::size_t new_size,
+                              ::std::size_t fence_size = debug_fence_size) noexcept {
+        auto* const node = static_cast<::std::byte*>(memory);
+        if (current_ != node + size + fence_size ||
+            static_cast<::std::size_t>(end - node) < new_size + fence_size) {
+            return false;
+        }
+
+        current_ = node + size;
+        advance(new_size - size, debug_magic::new_memory);
+        advance(fence_size, debug_magic::fence_memory);
+        return true;
+    }
+
     constexpr void unwind(::std::byte* top) noexcept {
         debug_fill(top, static_cast<::std::size_t>(current_ - top), debug_magic::freed_memory);
         current_ = top;
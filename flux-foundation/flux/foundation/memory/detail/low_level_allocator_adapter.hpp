@@ -1,6 +1,8 @@
 #pragma once
 #include <flux/foundation/memory/align.hpp>
+#include <flux/foundation/memory/debugging.hpp>
 #include <flux/foundation/memory/detail/debug_helpers.hpp>
+#include <flux/foundation/memory/memory_block.hpp>
 
 namespace flux::fou::detail {
 
@@ -22,6 +24,27 @@ concept low_level_allocator =
         { Allocator::max_size() } noexcept -> meta::same_as<::std::size_t>;
         { Allocator::info()     } noexcept -> meta::same_as<allocator_info>;
     };
+
+// Optional, grows the memory in place.
+template <typename Allocator>
+concept expandable_low_level_allocator =
+    requires(void* memory, ::std::size_t size) {
+        { Allocator::expand(memory, size) } noexcept -> meta::same_as<bool>;
+    };
+
+// Optional, resizes the memory like `realloc()`.
+template <typename Allocator>
+concept reallocatable_low_level_allocator =
+    requires(void* memory, ::std::size_t size) {
+        { Allocator::reallocate(memory, size) } noexcept -> meta::same_as<void*>;
+    };
+
+// Optional, the size of the memory that was actually reserved for an allocation.
+template <typename Allocator>
+concept sized_low_level_allocator =
+    requires(void* memory) {
+        { Allocator::usable_size(memory) } noexcept -> meta::same_as<::std::size_t>;
+    };
 // clang-format on
 
 template <low_level_allocator Allocator>
@@ -58,6 +81,52 @@ struct [[nodiscard]] low_level_allocator_adapter
         leak_detector::on_deallocate(actual_size);
     }
 
+    constexpr memory_block allocate_at_least(size_type size, size_type alignment) noexcept
+        requires sized_low_level_allocator<allocator_type>
+    {
+        auto const fence  = debug_fence_size ? max_alignment : 0u;
+        auto       memory = allocator_type::allocate(size + 2u * fence, alignment);
+
+        auto const actual_size = allocator_type::usable_size(memory);
+        leak_detector::on_allocate(actual_size);
+
+        size = actual_size - 2u * fence;
+        return {debug_fill_new(memory, size, max_alignment), size};
+    }
+
+    constexpr bool try_expand(void* node, size_type size, size_type new_size,
+                              size_type) noexcept
+        requires expandable_low_level_allocator<allocator_type>
+    {
+        auto const fence  = debug_fence_size ? max_alignment : 0u;
+        auto*      memory = static_cast<::std::byte*>(node);
+        if (!allocator_type::expand(memory - fence, new_size + 2u * fence))
+            return false;
+
+        // The fence behind the node becomes a part of it.
+        debug_fill(memory + size, new_size - size, debug_magic::new_memory);
+        debug_fill(memory + new_size, fence, debug_magic::fence_memory);
+        leak_detector::on_allocate(new_size - size);
+        return true;
+    }
+
+    constexpr void* try_reallocate(void* node, size_type size, size_type new_size,
+                                   size_type) noexcept
+        requires reallocatable_low_level_allocator<allocator_type>
+    {
+        auto const fence       = debug_fence_size ? max_alignment : 0u;
+        auto const actual_size = new_size + 2u * fence;
+        auto*      memory      = static_cast<::std::byte*>(node) - fence;
+        memory = static_cast<::std::byte*>(allocator_type::reallocate(memory, actual_size)) + fence;
+
+        if (new_size > size)
+            debug_fill(memory + size, new_size - size, debug_magic::new_memory);
+        debug_fill(memory + new_size, fence, debug_magic::fence_memory);
+        leak_detector::on_deallocate(size + 2u * fence);
+        leak_detector::on_allocate(actual_size);
+        return memory;
+    }
+
     constexpr size_type max_node_size() const noexcept {
         return allocator_type::max_size();
     }
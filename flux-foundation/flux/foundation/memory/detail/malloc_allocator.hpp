@@ -2,6 +2,10 @@
 #include <flux/foundation/memory/debugging.hpp>
 #include <flux/foundation/utility/terminate.hpp>
 
+#if FLUX_TARGET(LINUX)
+#    include <malloc.h>
+#endif
+
 namespace flux::fou::detail {
 
 // clang-format off
@@ -43,6 +47,23 @@ struct [[nodiscard]] malloc_allocator final {
         return memory;
     }
 
+    // Grows `memory` to `size` bytes if the block malloc has reserved for it is large enough.
+    static inline bool expand([[maybe_unused]] void*     memory,
+                              [[maybe_unused]] size_type size) noexcept {
+#if FLUX_TARGET(LINUX)
+        return usable_size(memory) >= size;
+#else
+        return false;
+#endif
+    }
+
+#if FLUX_TARGET(LINUX)
+    // The size of the block malloc has reserved for `memory`, it is at least the requested one.
+    static inline size_type usable_size(void* memory) noexcept {
+        return ::malloc_usable_size(memory);
+    }
+#endif
+
     static inline void deallocate(void* memory, size_type, size_type) noexcept {
         if (!memory)
             return;
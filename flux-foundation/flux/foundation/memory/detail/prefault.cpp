@@ -0,0 +1,58 @@
+#include <flux/foundation/memory/detail/prefault.hpp>
+
+#if FLUX_TARGET(WINDOWS)
+#    include <flux/platform/win32/api.hpp>
+#else
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+namespace flux::fou::detail {
+
+namespace {
+
+bool lock_pages(void* memory, ::std::size_t size) noexcept {
+#if FLUX_TARGET(WINDOWS)
+    return win32::VirtualLock(memory, size) != 0;
+#else
+    return ::mlock(memory, size) == 0;
+#endif
+}
+
+} // namespace
+
+::std::size_t page_size() noexcept {
+#if FLUX_TARGET(WINDOWS)
+    // Windows doesn't have larger base pages on any supported architecture.
+    return 4096u;
+#else
+    static auto const size = static_cast<::std::size_t>(::sysconf(_SC_PAGESIZE));
+    return size;
+#endif
+}
+
+bool prefault(void* memory, ::std::size_t size, prefault_mode mode) noexcept {
+    if (mode == prefault_mode::none || size == 0u)
+        return true;
+
+    // A write is needed, reading a page that was never written to maps the shared zero page.
+    auto* bytes = static_cast<::std::byte volatile*>(memory);
+    for (::std::size_t offset = 0u; offset < size; offset += page_size())
+        bytes[offset] = bytes[offset];
+    bytes[size - 1u] = bytes[size - 1u];
+
+    return mode == prefault_mode::lock ? lock_pages(memory, size) : true;
+}
+
+void unlock(void* memory, ::std::size_t size) noexcept {
+    if (size == 0u)
+        return;
+    // Fails for pages that were never locked, which is fine.
+#if FLUX_TARGET(WINDOWS)
+    static_cast<void>(win32::VirtualUnlock(memory, size));
+#else
+    static_cast<void>(::munlock(memory, size));
+#endif
+}
+
+} // namespace flux::fou::detail
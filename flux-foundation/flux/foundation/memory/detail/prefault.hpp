@@ -0,0 +1,36 @@
+#pragma once
+#include <flux/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace flux::fou {
+
+// Controls what `reserve()` does with the pages of the blocks it allocates ahead of time.
+enum class prefault_mode : ::std::uint8_t {
+    // The blocks are only allocated, their pages are faulted in on first use.
+    none,
+    // Every page is written to once, so that the page faults happen during the reservation.
+    touch,
+    // Like `touch`, but the pages are additionally locked into memory and will never be swapped.
+    // NOTE:
+    //  Locking is subject to `RLIMIT_MEMLOCK` on Linux and the working set size on Windows.
+    //  The pages stay locked until their block is returned to its block allocator.
+    lock
+};
+
+namespace detail {
+
+// Returns the size of a virtual memory page of the system.
+::std::size_t page_size() noexcept;
+
+// Faults in the pages of the given memory according to `mode`, the content of the memory is left
+// untouched. Returns `false` if the pages were requested to be locked, but that failed.
+bool prefault(void* memory, ::std::size_t size, prefault_mode mode) noexcept;
+
+// Unlocks the pages of the given memory, which may or may not have been locked by `prefault()`.
+void unlock(void* memory, ::std::size_t size) noexcept;
+
+} // namespace detail
+
+} // namespace flux::fou
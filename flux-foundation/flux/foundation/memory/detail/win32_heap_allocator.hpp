@@ -63,6 +63,13 @@ struct [[nodiscard]] win32_heap_allocator final {
         return win32_heaprealloc_common(memory, size, 0u);
     }
 
+    // Grows `memory` to `size` bytes if the heap can do so without moving it.
+    static inline bool expand(void* memory, size_type size) noexcept {
+        constexpr ::std::uint_least32_t heap_realloc_in_place_only = 0x00000010u;
+        return win32::HeapReAlloc(win32::GetProcessHeap(), heap_realloc_in_place_only, memory,
+                                  size) != nullptr;
+    }
+
     static inline void deallocate(void* memory, size_type, size_type) noexcept {
         if (!memory)
             return;
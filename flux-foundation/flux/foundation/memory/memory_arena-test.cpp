@@ -229,6 +229,37 @@ TEST_CASE("fou::memory_arena_cached", "[flux-memory/memory_arena.hpp]") {
         CHECK(other.capacity() == 0u);
     }
 
+    SECTION("reserve") {
+        memory_arena_cached arena(1024);
+        CHECK(arena.reserve(2000u));
+        CHECK(arena.allocator().i == 2u);
+        CHECK(arena.size() == 0u);
+        CHECK(arena.capacity() == 2u);
+        CHECK(arena.next_block_size() == 1008u);
+
+        CHECK(arena.reserve(1000u, prefault_mode::none));
+        CHECK(arena.allocator().i == 2u);
+
+        [[maybe_unused]] auto block1 = arena.allocate_block();
+        [[maybe_unused]] auto block2 = arena.allocate_block();
+        CHECK(arena.allocator().i == 2u);
+        CHECK(arena.size() == 2u);
+        CHECK(arena.capacity() == 2u);
+    }
+
+    SECTION("reserve locked") {
+        memory_arena_cached arena(1024);
+        // Locking may fail because of the limits of the system, the blocks are reserved anyway.
+        static_cast<void>(arena.reserve(1000u, prefault_mode::lock));
+        CHECK(arena.allocator().i == 1u);
+
+        [[maybe_unused]] auto block = arena.allocate_block();
+        arena.deallocate_block();
+        arena.shrink_to_fit();
+        CHECK(arena.allocator().i == 0u);
+        CHECK(arena.capacity() == 0u);
+    }
+
     SECTION("small arena") {
         memory_arena_cached small_arena(memory_arena_cached::min_block_size(1));
         CHECK(small_arena.allocator().i == 0u);
@@ -2,6 +2,7 @@
 #include <flux/foundation/memory/allocator_traits.hpp>
 #include <flux/foundation/memory/detail/construct_at.hpp>
 #include <flux/foundation/memory/detail/debug_helpers.hpp>
+#include <flux/foundation/memory/detail/prefault.hpp>
 #include <flux/foundation/memory/memory_block.hpp>
 
 namespace flux::fou {
@@ -67,6 +68,15 @@ struct [[nodiscard]] memory_block_stack final {
         return count;
     }
 
+    // Returns the total usable size of all blocks on the stack.
+    constexpr ::std::size_t byte_size() const noexcept {
+        ::std::size_t bytes = 0u;
+        for (auto* node = head_; node; node = node->prev) {
+            bytes += node->size;
+        }
+        return bytes;
+    }
+
     constexpr bool contains(void const* ptr) const noexcept {
         auto* address = static_cast<::std::byte const*>(ptr);
         for (auto* node = head_; node; node = node->prev) {
@@ -110,6 +120,16 @@ protected:
         return cache_.empty();
     }
 
+    constexpr ::std::size_t byte_size() const noexcept {
+        return cache_.byte_size();
+    }
+
+    // Moves the blocks into the cache, so that they are reused in the order they were allocated.
+    constexpr void assign_cache(memory_block_stack& blocks) noexcept {
+        while (!blocks.empty())
+            cache_.steal_top(blocks);
+    }
+
     constexpr bool assign_block(memory_block_stack& used) noexcept {
         if (cache_.empty()) [[unlikely]] {
             return false;
@@ -118,20 +138,21 @@ protected:
         return true;
     }
 
-    template <typename BlockAllocator>
-    constexpr void deallocate_block(BlockAllocator&, memory_block_stack& used) noexcept {
+    template <typename Release>
+    constexpr void deallocate_block(Release&&, memory_block_stack& used) noexcept {
         cache_.steal_top(used);
     }
 
-    template <typename BlockAllocator>
-    constexpr void shrink_to_fit(BlockAllocator& allocator) noexcept {
+    // The `release` function returns a block to the block allocator.
+    template <typename Release>
+    constexpr void shrink_to_fit(Release&& release) noexcept {
         memory_block_stack to_deallocate;
         // Pop from cache and push to temporary stack
         while (!cache_.empty())
             to_deallocate.steal_top(cache_);
         // Now deallocate everything
         while (!to_deallocate.empty())
-            allocator.deallocate_block(to_deallocate.pop());
+            release(to_deallocate.pop());
     }
 
 private:
@@ -157,13 +178,13 @@ protected:
         return false;
     }
 
-    template <typename BlockAllocator>
-    constexpr void deallocate_block(BlockAllocator& allocator, memory_block_stack& used) noexcept {
-        allocator.deallocate_block(used.pop());
+    template <typename Release>
+    constexpr void deallocate_block(Release&& release, memory_block_stack& used) noexcept {
+        release(used.pop());
     }
 
-    template <typename BlockAllocator>
-    constexpr void shrink_to_fit(BlockAllocator&) noexcept {}
+    template <typename Release>
+    constexpr void shrink_to_fit(Release&&) noexcept {}
 };
 // clang-format on
 
@@ -207,7 +228,7 @@ public:
     constexpr ~memory_arena() {
         shrink_to_fit();
         while (!used_blocks_.empty()) {
-            allocator_type::deallocate_block(used_blocks_.pop());
+            release_block(used_blocks_.pop());
         }
     }
 
@@ -215,7 +236,8 @@ public:
     constexpr memory_arena(memory_arena&& other) noexcept
             : allocator_type{::std::move(other             )},
               memory_cache  {::std::move(other             )},
-              used_blocks_  {::std::move(other.used_blocks_)} {}
+              used_blocks_  {::std::move(other.used_blocks_)},
+              locked_       {other.locked_                   } {}
     // clang-format on
 
     constexpr memory_arena& operator=(memory_arena&& other) noexcept = default;
@@ -237,7 +259,7 @@ public:
     constexpr void deallocate_block() noexcept {
         auto block = used_blocks_.top();
         detail::debug_fill_internal(block.memory, block.size, true);
-        memory_cache::deallocate_block(allocator(), used_blocks_);
+        memory_cache::deallocate_block(releaser(), used_blocks_);
     }
 
     constexpr bool contains(void const* ptr) const noexcept {
@@ -245,7 +267,34 @@ public:
     }
 
     constexpr void shrink_to_fit() noexcept {
-        memory_cache::shrink_to_fit(allocator());
+        memory_cache::shrink_to_fit(releaser());
+    }
+
+    // Allocates blocks ahead of time and puts them into the cache, until the cached blocks provide
+    // at least `bytes` of usable memory. Their pages are pre-faulted according to `mode`, so that
+    // neither the `BlockAllocator` nor the page fault handler are hit on the first allocations.
+    // Returns `false` if the pages should have been locked, but that failed.
+    constexpr bool reserve(size_type bytes, prefault_mode mode = prefault_mode::touch) noexcept
+        requires(IsCached)
+    {
+        auto         locked = true;
+        memory_stack reserved;
+        for (auto cached = memory_cache::byte_size(); cached < bytes;) {
+            auto block = allocator_type::allocate_block();
+            locked     = prefault(block, mode) && locked;
+            reserved.push(block);
+            cached += block.size - memory_stack::offset();
+        }
+        memory_cache::assign_cache(reserved);
+        return locked;
+    }
+
+    // Pre-faults the pages of a `block` of this arena according to `mode`. The arena remembers when
+    // pages were locked and unlocks its blocks before returning them to the `BlockAllocator`.
+    // Returns `false` if the pages should have been locked, but that failed.
+    constexpr bool prefault(memory_block block, prefault_mode mode) noexcept {
+        locked_ = locked_ || mode == prefault_mode::lock;
+        return detail::prefault(block.memory, block.size, mode);
     }
 
     constexpr size_type size() const noexcept {
@@ -274,7 +323,18 @@ public:
     }
 
 private:
+    constexpr void release_block(memory_block block) noexcept {
+        if (locked_)
+            detail::unlock(block.memory, block.size);
+        allocator_type::deallocate_block(block);
+    }
+
+    constexpr auto releaser() noexcept {
+        return [this](memory_block block) noexcept { release_block(block); };
+    }
+
     memory_stack used_blocks_;
+    bool         locked_ = false;
 };
 
 // An allocator that uses a given `RawAllocator` for allocating the blocks. It calls the
@@ -0,0 +1,139 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <thread>
+#include <vector>
+
+using namespace flux::fou;
+
+TEST_CASE("fou::memory_block_depot", "[flux-memory/memory_block_depot.hpp]") {
+    using depot_type = memory_block_depot<heap_allocator>;
+    depot_type depot{8192u};
+    CHECK(depot.max_bytes() == 8192u);
+    CHECK(depot.cached_bytes() == 0u);
+    CHECK(depot.cached_blocks() == 0u);
+    CHECK(!depot.acquire(1024u));
+
+    auto a = depot.allocate_block(1024u);
+    CHECK(a.memory);
+    CHECK(a.size == 1024u);
+    CHECK(is_aligned(a.memory, detail::max_alignment));
+
+    depot.release(a);
+    CHECK(depot.cached_bytes() == 1024u);
+    CHECK(depot.cached_blocks() == 1u);
+
+    SECTION("reuse") {
+        auto b = depot.allocate_block(1000u);
+        CHECK(b.memory == a.memory);
+        CHECK(b.size == 1024u);
+        CHECK(depot.cached_blocks() == 0u);
+        depot.release(b);
+    }
+    SECTION("too small") {
+        CHECK(!depot.acquire(1025u));
+        CHECK(depot.cached_blocks() == 1u);
+    }
+    SECTION("larger class") {
+        auto b = depot.allocate_block(4096u);
+        depot.release(b);
+        CHECK(depot.cached_blocks() == 2u);
+
+        // 2048 is not cached, but the 4096 byte block is at most two classes away.
+        auto c = depot.acquire(2048u);
+        CHECK(c.memory == b.memory);
+        CHECK(c.size == 4096u);
+        depot.release(c);
+    }
+    SECTION("byte cap") {
+        auto b = depot.allocate_block(4096u);
+        auto c = depot.allocate_block(4096u);
+        depot.release(b);
+        depot.release(c);
+        // The oldest block has been evicted to make room for `c`.
+        CHECK(depot.cached_bytes() == 8192u);
+        CHECK(depot.cached_blocks() == 2u);
+
+        auto d = depot.allocate_block(16384u);
+        depot.release(d);
+        CHECK(depot.cached_bytes() == 8192u);
+
+        depot.max_bytes(4096u);
+        CHECK(depot.cached_bytes() == 4096u);
+        CHECK(depot.acquire(4096u).memory == c.memory);
+        depot.release(c);
+    }
+    SECTION("trim_idle") {
+        CHECK(depot.tick() == 1u);
+        auto b = depot.allocate_block(2048u);
+        depot.release(b);
+        depot.tick();
+        depot.tick();
+
+        depot.trim_idle(2u);
+        CHECK(depot.cached_blocks() == 1u);
+        CHECK(depot.cached_bytes() == 2048u);
+        depot.trim_idle(0u);
+        CHECK(depot.cached_blocks() == 0u);
+    }
+    SECTION("trim") {
+        depot.release(depot.allocate_block(2048u));
+        depot.trim(2048u);
+        CHECK(depot.cached_bytes() == 2048u);
+        depot.trim();
+        CHECK(depot.cached_bytes() == 0u);
+    }
+}
+
+TEST_CASE("fou::depot_block_allocator", "[flux-memory/memory_block_depot.hpp]") {
+    using depot_type      = memory_block_depot<heap_allocator>;
+    using block_allocator = depot_block_allocator<depot_type>;
+    depot_type depot;
+
+    SECTION("shared between arenas") {
+        void* first = nullptr;
+        {
+            memory_arena<block_allocator> arena{4096u, depot};
+            CHECK(&arena.allocator().depot() == &depot);
+            first = arena.allocate_block().memory;
+            [[maybe_unused]] auto second = arena.allocate_block();
+        }
+        CHECK(depot.cached_blocks() == 2u);
+        CHECK(depot.cached_bytes() == 4096u + 8192u);
+
+        memory_arena<block_allocator> other{4096u, depot};
+        auto block = other.allocate_block();
+        CHECK(block.memory == first);
+        CHECK(depot.cached_blocks() == 1u);
+    }
+    SECTION("memory_stack") {
+        {
+            memory_stack<block_allocator> stack{4096u, depot};
+            for (auto i = 0u; i < 16u; ++i)
+                CHECK(stack.allocate(1024u, 8u));
+        }
+        auto const cached = depot.cached_bytes();
+        CHECK(cached > 0u);
+        {
+            memory_stack<block_allocator> stack{4096u, depot};
+            stack.allocate(1024u, 8u);
+        }
+        CHECK(depot.cached_bytes() == cached);
+    }
+    SECTION("threads") {
+        ::std::vector<::std::thread> threads;
+        for (auto i = 0u; i < 4u; ++i) {
+            threads.emplace_back([&] {
+                for (auto j = 0u; j < 64u; ++j) {
+                    memory_stack<block_allocator> stack{1024u, depot};
+                    for (auto k = 0u; k < 8u; ++k)
+                        stack.allocate(512u, 8u);
+                }
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+        CHECK(depot.cached_bytes() <= depot.max_bytes());
+    }
+}
@@ -0,0 +1,312 @@
+#pragma once
+#include <flux/foundation/memory/default_allocator.hpp>
+#include <flux/foundation/memory/memory_arena.hpp>
+#include <flux/foundation/memory/threading.hpp>
+
+namespace flux::fou {
+
+namespace detail {
+
+// Bookkeeping stored at the beginning of every block parked in a `memory_block_depot`. Each node
+// is linked into the list of its size class and into the global LRU list of the depot.
+struct [[nodiscard]] depot_block_node final {
+    depot_block_node* prev;
+    depot_block_node* next;
+    depot_block_node* older;
+    depot_block_node* newer;
+    ::std::size_t     size;
+    ::std::size_t     epoch;
+};
+
+} // namespace detail
+
+// A process-wide, thread-safe cache of memory blocks shared between arenas. Blocks are grouped by
+// size class (the power of two below their size) and handed out before the `RawAllocator` is asked
+// for new memory, so one subsystem can reuse blocks another one has released. The amount of cached
+// memory is bounded by `max_bytes()`: when the cap is exceeded the least recently released blocks
+// are returned to the `RawAllocator`. Callers can additionally age the cache with `tick()` and
+// `trim_idle()`, or drop everything with `trim()` on memory pressure.
+// NOTE:
+//  The `RawAllocator` must be stateless, because blocks released by one arena may be deallocated by
+//  the depot on behalf of any other.
+template <thread_safe_allocator RawAllocator = default_allocator, lockable Mutex = ::std::mutex>
+class [[nodiscard]] memory_block_depot : allocator_traits<RawAllocator>::allocator_type {
+    using allocator_traits = allocator_traits<RawAllocator>;
+    using node_type        = detail::depot_block_node;
+
+public:
+    using allocator_type  = typename allocator_traits::allocator_type;
+    using size_type       = typename allocator_traits::size_type;
+    using difference_type = typename allocator_traits::difference_type;
+    using mutex_type      = Mutex;
+
+    static constexpr size_type size_classes     = sizeof(size_type) * CHAR_BIT;
+    static constexpr size_type min_block_size   = sizeof(node_type);
+    static constexpr size_type default_max_size = size_type(64) * 1024u * 1024u;
+
+    constexpr explicit memory_block_depot(size_type max_bytes = default_max_size) noexcept
+            : max_bytes_{max_bytes} {}
+
+    ~memory_block_depot() {
+        trim();
+    }
+
+    memory_block_depot(memory_block_depot const&)            = delete;
+    memory_block_depot& operator=(memory_block_depot const&) = delete;
+
+    // Returns the depot shared by every `depot_block_allocator` that was not given another one.
+    static memory_block_depot& global() noexcept {
+        static memory_block_depot depot;
+        return depot;
+    }
+
+    // Returns a cached block of at least `size` bytes, or an empty block if there is none.
+    memory_block acquire(size_type size) noexcept {
+        lock_guard_t<mutex_type> guard{mutex_};
+        auto* node = find(size);
+        if (!node)
+            return {};
+        unlink(node);
+        return {static_cast<void*>(node), node->size};
+    }
+
+    // Returns a cached block of at least `size` bytes or allocates a new one of exactly `size`.
+    memory_block allocate_block(size_type size) noexcept {
+        if (auto block = acquire(size))
+            return block;
+        auto* memory = allocator_traits::allocate_array(allocator(), size, 1u,
+                                                        detail::max_alignment);
+        return {memory, size};
+    }
+
+    // Parks a block in the depot. If that exceeds the byte cap, the least recently released blocks
+    // are deallocated until the depot fits again.
+    void release(memory_block block) noexcept {
+        FLUX_ASSERT(block.memory);
+        FLUX_ASSERT(is_aligned(block.memory, detail::max_alignment));
+        if (block.size < min_block_size) [[unlikely]] {
+            deallocate(block);
+            return;
+        }
+
+        node_type* evicted = nullptr;
+        {
+            lock_guard_t<mutex_type> guard{mutex_};
+            if (block.size > max_bytes_) {
+                evicted = detail::construct_at(static_cast<node_type*>(block.memory));
+                evicted->size = block.size;
+            } else {
+                link(block);
+                evicted = evict(max_bytes_);
+            }
+        }
+        deallocate(evicted);
+    }
+
+    // Advances the logical clock used by `trim_idle()` and returns the new epoch.
+    size_type tick() noexcept {
+        lock_guard_t<mutex_type> guard{mutex_};
+        return ++epoch_;
+    }
+
+    // Deallocates every block that has been parked for more than `max_idle` epochs.
+    void trim_idle(size_type max_idle) noexcept {
+        node_type* evicted = nullptr;
+        {
+            lock_guard_t<mutex_type> guard{mutex_};
+            while (oldest_ && epoch_ - oldest_->epoch > max_idle) {
+                auto* node = oldest_;
+                unlink(node);
+                node->next = ::std::exchange(evicted, node);
+            }
+        }
+        deallocate(evicted);
+    }
+
+    // Deallocates least recently released blocks until at most `max_bytes` remain cached.
+    void trim(size_type max_bytes = 0u) noexcept {
+        node_type* evicted = nullptr;
+        {
+            lock_guard_t<mutex_type> guard{mutex_};
+            evicted = evict(max_bytes);
+        }
+        deallocate(evicted);
+    }
+
+    size_type max_bytes() const noexcept {
+        lock_guard_t<mutex_type> guard{mutex_};
+        return max_bytes_;
+    }
+
+    void max_bytes(size_type max_bytes) noexcept {
+        {
+            lock_guard_t<mutex_type> guard{mutex_};
+            max_bytes_ = max_bytes;
+        }
+        trim(max_bytes);
+    }
+
+    size_type cached_bytes() const noexcept {
+        lock_guard_t<mutex_type> guard{mutex_};
+        return cached_bytes_;
+    }
+
+    size_type cached_blocks() const noexcept {
+        lock_guard_t<mutex_type> guard{mutex_};
+        return cached_blocks_;
+    }
+
+    allocator_type& allocator() noexcept {
+        return *this;
+    }
+
+private:
+    static constexpr size_type size_class(size_type size) noexcept {
+        return ilog2(size);
+    }
+
+    node_type* find(size_type size) const noexcept {
+        // Blocks of the same size class may still be too small, so only that list is searched.
+        auto const lower = size_class(size);
+        for (auto* node = classes_[lower]; node; node = node->next) {
+            if (node->size >= size)
+                return node;
+        }
+        // Any block of the next two classes is big enough, but wastes at most four times `size`.
+        for (auto index = lower + 1u; index < ::std::min(lower + 3u, size_classes); ++index) {
+            if (classes_[index])
+                return classes_[index];
+        }
+        return nullptr;
+    }
+
+    void link(memory_block block) noexcept {
+        auto& head = classes_[size_class(block.size)];
+        auto* node = detail::construct_at(static_cast<node_type*>(block.memory),
+                                          nullptr, head, newest_, nullptr, block.size, epoch_);
+        if (head)
+            head->prev = node;
+        head = node;
+
+        if (newest_)
+            newest_->newer = node;
+        else
+            oldest_ = node;
+        newest_ = node;
+
+        cached_bytes_ += block.size;
+        ++cached_blocks_;
+    }
+
+    void unlink(node_type* node) noexcept {
+        if (node->prev)
+            node->prev->next = node->next;
+        else
+            classes_[size_class(node->size)] = node->next;
+        if (node->next)
+            node->next->prev = node->prev;
+
+        if (node->older)
+            node->older->newer = node->newer;
+        else
+            oldest_ = node->newer;
+        if (node->newer)
+            node->newer->older = node->older;
+        else
+            newest_ = node->older;
+
+        cached_bytes_ -= node->size;
+        --cached_blocks_;
+    }
+
+    // Unlinks the oldest blocks until at most `max_bytes` remain and returns them as a list that
+    // is chained through `next`, so they can be deallocated once the lock has been released.
+    node_type* evict(size_type max_bytes) noexcept {
+        node_type* evicted = nullptr;
+        while (oldest_ && cached_bytes_ > max_bytes) {
+            auto* node = oldest_;
+            unlink(node);
+            node->next = ::std::exchange(evicted, node);
+        }
+        return evicted;
+    }
+
+    void deallocate(node_type* evicted) noexcept {
+        while (evicted) {
+            auto* next = evicted->next;
+            deallocate({static_cast<void*>(evicted), evicted->size});
+            evicted = next;
+        }
+    }
+
+    void deallocate(memory_block block) noexcept {
+        allocator_traits::deallocate_array(allocator(), block.memory, block.size, 1u,
+                                           detail::max_alignment);
+    }
+
+    node_type*         classes_[size_classes] = {};
+    node_type*         oldest_                = nullptr;
+    node_type*         newest_                = nullptr;
+    size_type          cached_bytes_          = 0u;
+    size_type          cached_blocks_         = 0u;
+    size_type          epoch_                 = 0u;
+    size_type          max_bytes_;
+    mutable mutex_type mutex_;
+};
+
+// A `BlockAllocator` that grows like `growing_block_allocator`, but takes its blocks from a
+// `memory_block_depot` and releases them back to it instead of deallocating them. Arenas using it
+// will reuse blocks released by any other arena sharing the same depot.
+// clang-format off
+template <
+    typename Depot       = memory_block_depot<>,
+    unsigned Numerator   = 2u,
+    unsigned Denominator = 1u
+>
+// clang-format on
+class [[nodiscard]] depot_block_allocator {
+    static_assert(float(Numerator) / Denominator >= 1.0f, "Invalid growth factor");
+
+public:
+    using depot_type      = Depot;
+    using allocator_type  = typename depot_type::allocator_type;
+    using size_type       = typename depot_type::size_type;
+    using difference_type = typename depot_type::difference_type;
+
+    constexpr explicit depot_block_allocator(size_type   block_size,
+                                             depot_type& depot = depot_type::global()) noexcept
+            : depot_{&depot}, block_size_{block_size} {}
+
+    memory_block allocate_block() noexcept {
+        auto block  = depot_->allocate_block(block_size_);
+        block_size_ = new_block_size(block_size_);
+        return block;
+    }
+
+    void deallocate_block(memory_block block) noexcept {
+        depot_->release(block);
+    }
+
+    constexpr size_type block_size() const noexcept {
+        return block_size_;
+    }
+
+    constexpr depot_type& depot() const noexcept {
+        return *depot_;
+    }
+
+    static constexpr auto growth_factor() noexcept {
+        static constexpr auto factor = float(Numerator) / Denominator;
+        return factor;
+    }
+
+    static constexpr size_type new_block_size(size_type block_size) noexcept {
+        return block_size * Numerator / Denominator;
+    }
+
+private:
+    depot_type* depot_;
+    size_type   block_size_;
+};
+
+} // namespace flux::fou
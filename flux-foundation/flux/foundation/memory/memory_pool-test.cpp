@@ -69,6 +69,20 @@ TEST_CASE("fou::memory_pool", "[flux-memory/memory_pool.hpp]") {
             CHECK(pool.capacity() >= capacity);
         }
 
+        SECTION("reset") {
+            auto const capacity = pool.capacity();
+            for (::std::size_t i = 0u; i < 100u; ++i) {
+                CHECK(pool.allocate_node());
+            }
+
+            pool.reset();
+            CHECK(pool.capacity() == capacity);
+            for (::std::size_t i = 0u; i < capacity / pool.node_size(); ++i) {
+                CHECK(pool.try_allocate_node());
+            }
+            CHECK_FALSE(pool.try_allocate_node());
+        }
+
         SECTION("move") {
             memory_pool new_pool{::std::move(pool)};
             CHECK(new_pool.node_size() >= 4u);
@@ -91,6 +105,19 @@ TEST_CASE("fou::memory_pool", "[flux-memory/memory_pool.hpp]") {
 
         pool.deallocate_node(ptr);
     }
+    {
+        memory_pool pool{16, memory_pool::min_block_size(16, 4)};
+        CHECK(pool.reserve(100u));
+        CHECK(pool.capacity() >= 100u * 16u);
+
+        auto const capacity = pool.capacity();
+        CHECK(pool.reserve(10u, flux::fou::prefault_mode::none));
+        CHECK(pool.capacity() == capacity);
+
+        for (::std::size_t i = 0u; i < 100u; ++i) {
+            CHECK(pool.try_allocate_node());
+        }
+    }
 }
 
 TEST_CASE("fou::memory_pool_array", "[flux-memory/memory_pool.hpp]") {
@@ -126,6 +153,16 @@ TEST_CASE("fou::memory_pool_array", "[flux-memory/memory_pool.hpp]") {
         CHECK(pool.capacity() == capacity);
     }
 
+    SECTION("reset") {
+        auto capacity = pool.capacity();
+        CHECK(pool.allocate_array(25));
+        CHECK(pool.allocate_array(25));
+
+        pool.reset();
+        CHECK(pool.capacity() == capacity);
+        CHECK(pool.try_allocate_array(25));
+    }
+
     SECTION("allocate_array small") {
         memory_pool small_pool{memory_pool::min_node_size, memory_pool::min_block_size(1, 1)};
         auto*       array = small_pool.allocate_array(3);
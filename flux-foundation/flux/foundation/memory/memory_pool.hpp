@@ -103,6 +103,40 @@ public:
         return arena_.allocator();
     }
 
+    // Allocates blocks ahead of time until at least `count` nodes can be allocated without growing.
+    // Their pages are pre-faulted according to `mode`, see `memory_arena::reserve()`.
+    // Returns `false` if the pages should have been locked, but that failed.
+    constexpr bool reserve(size_type count, prefault_mode mode = prefault_mode::touch) noexcept {
+        auto locked = true;
+        while (list_.capacity() < count) {
+            auto block = arena_.allocate_block();
+            locked     = arena_.prefault(block, mode) && locked;
+            list_.insert(static_cast<::std::byte*>(block.memory), block.size);
+        }
+        return locked;
+    }
+
+    // Frees all nodes at once instead of one by one, every pointer to them becomes dangling. The
+    // blocks but the first one are returned to the arena, which caches them if `IsCached` is
+    // `enable_caching`, and the free list starts over with the first block.
+    constexpr void reset() noexcept {
+        for (auto count = arena_.size(); count > 1u; --count)
+            arena_.deallocate_block();
+
+        auto const node_size = list_.node_size();
+        auto const block     = arena_.current_block();
+        ::std::destroy_at(&list_);
+        ::std::construct_at(&list_, node_size);
+        list_.insert(static_cast<::std::byte*>(block.memory), block.size);
+        leak_detector::operator=(leak_detector{});
+    }
+
+    // Returns the cached blocks of the arena to the allocator, it has no effect if `IsCached` is
+    // `disable_caching`.
+    constexpr void shrink_to_fit() noexcept {
+        arena_.shrink_to_fit();
+    }
+
     static constexpr size_type min_block_size(size_type node_size, size_type count) noexcept {
         return memory_block_stack::offset() + memory_list::min_block_size(node_size, count);
     }
@@ -200,6 +234,39 @@ struct [[nodiscard]] allocator_traits<memory_pool<PoolType, RawAllocator>> final
         allocator.list_.deallocate(array, count * size);
         allocator.on_deallocate(count * size);
     }
+
+    // A node of the pool is used whole, whatever the requested `size`.
+    static constexpr memory_block
+    allocate_at_least(allocator_type& allocator,
+                      size_type       size     ,
+                      size_type       alignment) noexcept
+    {
+        (void)size;
+        auto const node_size = allocator.node_size();
+        return {allocate_node(allocator, node_size, alignment), node_size};
+    }
+
+    static constexpr bool
+    try_expand(allocator_type& allocator,
+               void*           node     ,
+               size_type       size     ,
+               size_type       new_size ,
+               size_type       alignment) noexcept
+    {
+        (void)allocator, (void)node, (void)size, (void)new_size, (void)alignment;
+        return false;
+    }
+
+    static constexpr void*
+    try_reallocate(allocator_type& allocator,
+                   void*           node     ,
+                   size_type       size     ,
+                   size_type       new_size ,
+                   size_type       alignment) noexcept
+    {
+        (void)allocator, (void)node, (void)size, (void)new_size, (void)alignment;
+        return nullptr;
+    }
     // clang-format on
 
     static constexpr size_type max_node_size(allocator_type const& allocator) noexcept {
@@ -229,11 +296,14 @@ struct [[nodiscard]] composable_traits<memory_pool<PoolType, BlockOrRawAllocator
     {
         using allocator_traits = allocator_traits<allocator_type>;
 
-        constexpr bool invalid_node_size  = size      > allocator_traits::max_node_size(allocator);
-        constexpr bool invalid_align      = alignment > allocator_traits::max_alignment(allocator);
+        auto const invalid_node_size  = size      > allocator_traits::max_node_size(allocator);
+        auto const invalid_align      = alignment > allocator_traits::max_alignment(allocator);
         if (invalid_node_size || invalid_align)
             return nullptr;
-        return allocator.try_allocate_node();
+        auto* memory = allocator.try_allocate_node();
+        if (memory)
+            allocator.on_allocate(size);
+        return memory;
     }
 
     static constexpr void*
@@ -244,12 +314,15 @@ struct [[nodiscard]] composable_traits<memory_pool<PoolType, BlockOrRawAllocator
     {
         using allocator_traits = allocator_traits<allocator_type>;
 
-        constexpr bool invalid_node_size  = size         > allocator_traits::max_node_size(allocator);
-        constexpr bool invalid_array_size = count * size > allocator_traits::max_array_size(allocator);
-        constexpr bool invalid_align      = alignment    > allocator_traits::max_alignment(allocator);
+        auto const invalid_node_size  = size         > allocator_traits::max_node_size(allocator);
+        auto const invalid_array_size = count * size > allocator_traits::max_array_size(allocator);
+        auto const invalid_align      = alignment    > allocator_traits::max_alignment(allocator);
         if (invalid_node_size || invalid_array_size || invalid_align)
             return nullptr;
-        return allocator.try_allocate_array(count, size);
+        auto* memory = allocator.try_allocate_array(count, size);
+        if (memory)
+            allocator.on_allocate(count * size);
+        return memory;
     }
 
     static constexpr bool
@@ -260,11 +333,12 @@ struct [[nodiscard]] composable_traits<memory_pool<PoolType, BlockOrRawAllocator
     {
         using allocator_traits = allocator_traits<allocator_type>;
 
-        constexpr bool invalid_node_size  = size      > allocator_traits::max_node_size(allocator);
-        constexpr bool invalid_align      = alignment > allocator_traits::max_alignment(allocator);
-        if (invalid_node_size || invalid_align)
+        auto const invalid_node_size  = size      > allocator_traits::max_node_size(allocator);
+        auto const invalid_align      = alignment > allocator_traits::max_alignment(allocator);
+        if (invalid_node_size || invalid_align || !allocator.try_deallocate_node(node))
             return false;
-        return allocator.try_deallocate_node(node);
+        allocator.on_deallocate(size);
+        return true;
     }
 
     static constexpr bool
@@ -276,12 +350,14 @@ struct [[nodiscard]] composable_traits<memory_pool<PoolType, BlockOrRawAllocator
     {
         using allocator_traits = allocator_traits<allocator_type>;
 
-        constexpr bool invalid_node_size  = size         > allocator_traits::max_node_size(allocator);
-        constexpr bool invalid_array_size = count * size > allocator_traits::max_array_size(allocator);
-        constexpr bool invalid_align      = alignment    > allocator_traits::max_alignment(allocator);
-        if (invalid_node_size || invalid_array_size || invalid_align)
+        auto const invalid_node_size  = size         > allocator_traits::max_node_size(allocator);
+        auto const invalid_array_size = count * size > allocator_traits::max_array_size(allocator);
+        auto const invalid_align      = alignment    > allocator_traits::max_alignment(allocator);
+        if (invalid_node_size || invalid_array_size || invalid_align ||
+            !allocator.try_deallocate_array(array, count, size))
             return false;
-        return allocator.try_deallocate_array(array, count, size);
+        allocator.on_deallocate(count * size);
+        return true;
     }
     // clang-format on
 };
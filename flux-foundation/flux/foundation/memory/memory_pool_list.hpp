@@ -274,6 +274,36 @@ struct [[nodiscard]] allocator_traits<memory_pool_list<PoolType, BucketType, Raw
         allocator.on_deallocate(count * size);
     }
 
+    static constexpr memory_block
+    allocate_at_least(allocator_type& allocator,
+                      size_type       size     ,
+                      size_type       alignment) noexcept
+    {
+        return {allocate_node(allocator, size, alignment), size};
+    }
+
+    static constexpr bool
+    try_expand(allocator_type& allocator,
+               void*           node     ,
+               size_type       size     ,
+               size_type       new_size ,
+               size_type       alignment) noexcept
+    {
+        (void)allocator, (void)node, (void)size, (void)new_size, (void)alignment;
+        return false;
+    }
+
+    static constexpr void*
+    try_reallocate(allocator_type& allocator,
+                   void*           node     ,
+                   size_type       size     ,
+                   size_type       new_size ,
+                   size_type       alignment) noexcept
+    {
+        (void)allocator, (void)node, (void)size, (void)new_size, (void)alignment;
+        return nullptr;
+    }
+
     static constexpr size_type max_node_size(allocator_type const& allocator) noexcept {
         return allocator.max_node_size();
     }
@@ -305,7 +335,10 @@ struct [[nodiscard]] composable_traits<memory_pool_list<PoolType, BucketType, Ra
 
         if (alignment > allocator_traits::max_alignment(allocator))
             return nullptr;
-        return allocator.try_allocate_node(size);
+        auto* memory = allocator.try_allocate_node(size);
+        if (memory)
+            allocator.on_allocate(size);
+        return memory;
     }
 
     static constexpr void*
@@ -316,11 +349,14 @@ struct [[nodiscard]] composable_traits<memory_pool_list<PoolType, BucketType, Ra
     {
         using allocator_traits = allocator_traits<allocator_type>;
 
-        constexpr bool invalid_array_size = count * size > allocator_traits::max_array_size(allocator);
-        constexpr bool invalid_align      = alignment    > allocator_traits::max_alignment(allocator);
+        auto const invalid_array_size = count * size > allocator_traits::max_array_size(allocator);
+        auto const invalid_align      = alignment    > allocator_traits::max_alignment(allocator);
         if (invalid_array_size || invalid_align)
             return nullptr;
-        return allocator.try_allocate_array(count, size);
+        auto* memory = allocator.try_allocate_array(count, size);
+        if (memory)
+            allocator.on_allocate(count * size);
+        return memory;
     }
 
     static constexpr bool
@@ -331,9 +367,11 @@ struct [[nodiscard]] composable_traits<memory_pool_list<PoolType, BucketType, Ra
     {
         using allocator_traits = allocator_traits<allocator_type>;
 
-        if (alignment > allocator_traits::max_alignment(allocator))
+        if (alignment > allocator_traits::max_alignment(allocator) ||
+            !allocator.try_deallocate_node(node, size))
             return false;
-        return allocator.try_deallocate_node(node, size);
+        allocator.on_deallocate(size);
+        return true;
     }
 
     static constexpr bool
@@ -345,11 +383,13 @@ struct [[nodiscard]] composable_traits<memory_pool_list<PoolType, BucketType, Ra
     {
         using allocator_traits = allocator_traits<allocator_type>;
 
-        constexpr bool invalid_array_size = count * size > allocator_traits::max_array_size(allocator);
-        constexpr bool invalid_align      = alignment    > allocator_traits::max_alignment(allocator);
-        if (invalid_array_size || invalid_align)
+        auto const invalid_array_size = count * size > allocator_traits::max_array_size(allocator);
+        auto const invalid_align      = alignment    > allocator_traits::max_alignment(allocator);
+        if (invalid_array_size || invalid_align ||
+            !allocator.try_deallocate_array(array, count, size))
             return false;
-        return allocator.try_deallocate_array(array, count, size);
+        allocator.on_deallocate(count * size);
+        return true;
     }
     // clang-format on
 };
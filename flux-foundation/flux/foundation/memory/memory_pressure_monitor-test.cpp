@@ -0,0 +1,179 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <string>
+
+using namespace flux::fou;
+
+namespace {
+
+// Every run gets its own directory, so that test runs in parallel don't collide.
+::std::filesystem::path unique_root() noexcept {
+    auto const ticks = ::std::chrono::steady_clock::now().time_since_epoch().count();
+    auto const name  = "flux-memory-pressure-" + ::std::to_string(::std::random_device{}()) + "-" +
+                      ::std::to_string(ticks);
+    return ::std::filesystem::temp_directory_path() / name;
+}
+
+struct [[nodiscard]] pressure_fixture final {
+    pressure_fixture() noexcept : root{unique_root()} {
+        ::std::filesystem::create_directories(root);
+        write("pressure", "some avg10=0.00 avg60=0.00 avg300=0.00 total=0\n"
+                          "full avg10=0.00 avg60=0.00 avg300=0.00 total=0\n");
+        write("memory.events", "low 0\nhigh 0\nmax 0\noom 0\noom_kill 0\n");
+        write("memory.current", "1000\n");
+        write("memory.max", "max\n");
+    }
+
+    ~pressure_fixture() {
+        ::std::filesystem::remove_all(root);
+    }
+
+    void write(char const* name, char const* text) const noexcept {
+        auto* file = ::std::fopen((root / name).c_str(), "w");
+        REQUIRE(file);
+        ::std::fputs(text, file);
+        ::std::fclose(file);
+    }
+
+    memory_pressure_config config() const noexcept {
+        memory_pressure_config config;
+        config.pressure_path = pressure.c_str();
+        config.cgroup_path   = cgroup.c_str();
+        return config;
+    }
+
+    ::std::filesystem::path root;
+    ::std::string           pressure = (root / "pressure").string();
+    ::std::string           cgroup   = root.string();
+};
+
+struct [[nodiscard]] trim_counter final {
+    void shrink_to_fit() noexcept {
+        order[count++] = id;
+    }
+
+    int  id;
+    int* order;
+    int& count;
+};
+
+} // namespace
+
+TEST_CASE("fou::memory_pressure_monitor", "[flux-memory/memory_pressure_monitor.hpp]") {
+    pressure_fixture        fixture;
+    memory_pressure_monitor monitor{fixture.config()};
+    CHECK(monitor.size() == 0u);
+    CHECK(monitor.sample() == memory_pressure::none);
+    CHECK(monitor.last_sample().usage == 1000u);
+    CHECK(monitor.last_sample().limit == 0u);
+
+    int          order[3] = {};
+    int          count    = 0;
+    trim_counter a{1, order, count}, b{2, order, count}, c{3, order, count};
+    CHECK(monitor.add(b, 1));
+    CHECK(monitor.add(c, 2));
+    CHECK(monitor.add(a, 0));
+    CHECK(monitor.size() == 3u);
+
+    SECTION("no pressure") {
+        CHECK(monitor.poll() == memory_pressure::none);
+        CHECK(count == 0);
+    }
+    SECTION("psi") {
+        fixture.write("pressure", "some avg10=12.50 avg60=3.00 avg300=1.00 total=100\n"
+                                  "full avg10=0.00 avg60=0.00 avg300=0.00 total=0\n");
+        CHECK(monitor.poll() == memory_pressure::moderate);
+        CHECK(monitor.last_sample().some_avg10 == Approx(12.5f));
+        // No limit to check the usage against, so everything is trimmed.
+        CHECK(count == 3);
+        CHECK(order[0] == 1);
+        CHECK(order[1] == 2);
+        CHECK(order[2] == 3);
+
+        fixture.write("pressure", "some avg10=40.00 avg60=3.00 avg300=1.00 total=100\n"
+                                  "full avg10=6.00 avg60=0.00 avg300=0.00 total=0\n");
+        CHECK(monitor.sample() == memory_pressure::critical);
+    }
+    SECTION("events") {
+        fixture.write("memory.events", "low 0\nhigh 3\nmax 0\noom 0\noom_kill 0\n");
+        CHECK(monitor.sample() == memory_pressure::moderate);
+        CHECK(monitor.last_sample().high_events == 3u);
+        // Only new events are pressure.
+        CHECK(monitor.sample() == memory_pressure::none);
+
+        fixture.write("memory.events", "low 0\nhigh 3\nmax 0\noom 1\noom_kill 1\n");
+        CHECK(monitor.poll() == memory_pressure::critical);
+        CHECK(count == 3);
+    }
+    SECTION("usage") {
+        fixture.write("memory.max", "1200\n");
+        CHECK(monitor.sample() == memory_pressure::moderate);
+        CHECK(monitor.last_sample().limit == 1200u);
+
+        fixture.write("memory.current", "1190\n");
+        CHECK(monitor.sample() == memory_pressure::critical);
+
+        // The stall information reports pressure, but the usage is already below the moderate
+        // limit after the first target has been trimmed.
+        fixture.write("memory.current", "1000\n");
+        fixture.write("pressure", "some avg10=12.50 avg60=3.00 avg300=1.00 total=100\n"
+                                  "full avg10=0.00 avg60=0.00 avg300=0.00 total=0\n");
+        memory_pressure_config config = fixture.config();
+        config.moderate_usage         = 0.9f;
+        memory_pressure_monitor other{config};
+        CHECK(other.add(b, 1));
+        CHECK(other.add(a, 0));
+        CHECK(other.poll() == memory_pressure::moderate);
+        CHECK(count == 1);
+        CHECK(order[0] == 1);
+    }
+    SECTION("remove") {
+        monitor.remove(&b);
+        CHECK(monitor.size() == 2u);
+        monitor.remove(&b);
+        CHECK(monitor.size() == 2u);
+        monitor.trim_all();
+        CHECK(count == 2);
+        CHECK(order[0] == 1);
+        CHECK(order[1] == 3);
+    }
+    SECTION("missing files") {
+        memory_pressure_config config;
+        config.pressure_path = "/nonexistent/pressure";
+        config.cgroup_path   = "/nonexistent";
+        memory_pressure_monitor other{config};
+        CHECK(other.poll() == memory_pressure::none);
+        CHECK(other.last_sample().usage == 0u);
+    }
+}
+
+TEST_CASE("fou::memory_pressure_monitor allocators", "[flux-memory/memory_pressure_monitor.hpp]") {
+    memory_pressure_monitor monitor{memory_pressure_config{nullptr, nullptr}};
+
+    memory_arena<growing_block_allocator<>, enable_caching> arena{1024u};
+    [[maybe_unused]] auto first  = arena.allocate_block();
+    [[maybe_unused]] auto second = arena.allocate_block();
+    arena.deallocate_block();
+    arena.deallocate_block();
+    CHECK(arena.cache_size() == 2u);
+
+    memory_stack<> stack{1024u};
+    memory_pool<node_pool, default_allocator, enable_caching> pool{16u, 1024u};
+    memory_block_depot<heap_allocator>                        depot;
+    depot.release(depot.allocate_block(1024u));
+
+    CHECK(monitor.add(arena));
+    CHECK(monitor.add(stack));
+    CHECK(monitor.add(pool));
+    CHECK(monitor.add(depot, 1));
+    CHECK(monitor.add(get_temporary_stack()));
+    monitor.trim_all();
+    CHECK(arena.cache_size() == 0u);
+    CHECK(depot.cached_bytes() == 0u);
+}
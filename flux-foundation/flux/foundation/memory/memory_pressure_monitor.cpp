@@ -0,0 +1,179 @@
+#include <flux/foundation/memory/memory_pressure_monitor.hpp>
+#include <flux/foundation/utility/terminate.hpp>
+
+#include <flux/config.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace flux::fou {
+
+namespace {
+
+// The files we read are tiny, the PSI file is two lines and `memory.events` is five.
+constexpr ::std::size_t file_buffer_size = 512u;
+constexpr ::std::size_t path_buffer_size = 512u;
+
+// Reads the whole file into `buffer` as a null-terminated string, returns `false` if the file
+// couldn't be opened.
+bool read_file(char const* path, char (&buffer)[file_buffer_size]) noexcept {
+    auto* file = ::std::fopen(path, "r");
+    if (!file)
+        return false;
+    auto const size = ::std::fread(buffer, 1u, file_buffer_size - 1u, file);
+    ::std::fclose(file);
+    buffer[size] = '\0';
+    return true;
+}
+
+bool read_cgroup_file(char const* cgroup_path, char const* name,
+                      char (&buffer)[file_buffer_size]) noexcept {
+    char path[path_buffer_size];
+    auto length = ::std::snprintf(path, sizeof(path), "%s/%s", cgroup_path, name);
+    if (length < 0 || static_cast<::std::size_t>(length) >= sizeof(path)) [[unlikely]]
+        return false;
+    return read_file(path, buffer);
+}
+
+// Returns the value following `key` on the line starting with `line`, e.g. `avg10=` of `some`.
+char const* find_value(char const* text, char const* line, char const* key) noexcept {
+    auto const line_length = ::std::strlen(line);
+    for (auto* current = text; current && *current;) {
+        if (::std::strncmp(current, line, line_length) == 0 && current[line_length] == ' ') {
+            auto* end   = ::std::strchr(current, '\n');
+            auto* value = ::std::strstr(current, key);
+            if (value && (!end || value < end))
+                return value + ::std::strlen(key);
+            return nullptr;
+        }
+        current = ::std::strchr(current, '\n');
+        if (current)
+            ++current;
+    }
+    return nullptr;
+}
+
+float parse_avg10(char const* text, char const* line) noexcept {
+    auto* value = find_value(text, line, "avg10=");
+    return value ? ::std::strtof(value, nullptr) : 0.0f;
+}
+
+::std::uint64_t parse_event(char const* text, char const* line) noexcept {
+    auto* value = find_value(text, line, " ");
+    return value ? ::std::strtoull(value, nullptr, 10) : 0u;
+}
+
+::std::uint64_t parse_bytes(char const* text) noexcept {
+    // `memory.max` contains `max` if the cgroup is unlimited.
+    if (::std::strncmp(text, "max", 3u) == 0)
+        return 0u;
+    return ::std::strtoull(text, nullptr, 10);
+}
+
+memory_pressure_sample read_sample(memory_pressure_config const& config) noexcept {
+    memory_pressure_sample sample;
+    char                   buffer[file_buffer_size];
+
+    if (config.pressure_path && read_file(config.pressure_path, buffer)) {
+        sample.some_avg10 = parse_avg10(buffer, "some");
+        sample.full_avg10 = parse_avg10(buffer, "full");
+    }
+    if (!config.cgroup_path)
+        return sample;
+
+    if (read_cgroup_file(config.cgroup_path, "memory.events", buffer)) {
+        sample.high_events = parse_event(buffer, "high");
+        sample.max_events  = parse_event(buffer, "max");
+        sample.oom_events  = parse_event(buffer, "oom");
+    }
+    if (read_cgroup_file(config.cgroup_path, "memory.current", buffer))
+        sample.usage = parse_bytes(buffer);
+    if (read_cgroup_file(config.cgroup_path, "memory.max", buffer))
+        sample.limit = parse_bytes(buffer);
+    return sample;
+}
+
+} // namespace
+
+memory_pressure_monitor::memory_pressure_monitor(memory_pressure_config const& config) noexcept
+        : config_{config}, last_{read_sample(config)}, targets_{}, size_{0u} {}
+
+bool memory_pressure_monitor::add(void* object, trim_function trim, int priority) noexcept {
+    if (!object || !trim) [[unlikely]]
+        fast_terminate();
+    if (size_ == max_targets)
+        return false;
+
+    // Keep the targets sorted, equal priorities are trimmed in registration order.
+    auto index = size_;
+    for (; index > 0u && targets_[index - 1u].priority > priority; --index)
+        targets_[index] = targets_[index - 1u];
+    targets_[index] = entry{object, trim, priority};
+    ++size_;
+    return true;
+}
+
+void memory_pressure_monitor::remove(void const* object) noexcept {
+    for (auto index = 0u; index < size_; ++index) {
+        if (targets_[index].object != object)
+            continue;
+        for (--size_; index < size_; ++index)
+            targets_[index] = targets_[index + 1u];
+        return;
+    }
+}
+
+memory_pressure memory_pressure_monitor::sample() noexcept {
+    auto const current = read_sample(config_);
+    auto const level   = classify(current);
+    last_              = current;
+    return level;
+}
+
+memory_pressure memory_pressure_monitor::poll() noexcept {
+    auto const level = sample();
+    if (level == memory_pressure::critical) {
+        trim_all();
+    } else if (level == memory_pressure::moderate) {
+        auto const limit = last_.limit;
+        for (auto index = 0u; index < size_; ++index) {
+            targets_[index].trim(targets_[index].object);
+            // Without a limit there is no usage to check against, only the pressure stall
+            // information, which is averaged over seconds and won't react to our trimming.
+            if (limit && static_cast<float>(read_usage()) < config_.moderate_usage * float(limit))
+                break;
+        }
+    }
+    return level;
+}
+
+void memory_pressure_monitor::trim_all() noexcept {
+    for (auto index = 0u; index < size_; ++index)
+        targets_[index].trim(targets_[index].object);
+}
+
+memory_pressure
+memory_pressure_monitor::classify(memory_pressure_sample const& sample) const noexcept {
+    // The event counters are cumulative, only new events since the last sample are pressure.
+    auto const oom   = sample.oom_events > last_.oom_events || sample.max_events > last_.max_events;
+    auto const high  = sample.high_events > last_.high_events;
+    auto const usage = sample.limit ? float(sample.usage) / float(sample.limit) : 0.0f;
+
+    if (oom || sample.full_avg10 >= config_.full_avg10_threshold ||
+        (sample.limit && usage >= config_.critical_usage))
+        return memory_pressure::critical;
+    if (high || sample.some_avg10 >= config_.some_avg10_threshold ||
+        (sample.limit && usage >= config_.moderate_usage))
+        return memory_pressure::moderate;
+    return memory_pressure::none;
+}
+
+::std::uint64_t memory_pressure_monitor::read_usage() const noexcept {
+    char buffer[file_buffer_size];
+    if (config_.cgroup_path && read_cgroup_file(config_.cgroup_path, "memory.current", buffer))
+        return parse_bytes(buffer);
+    return last_.usage;
+}
+
+} // namespace flux::fou
@@ -0,0 +1,129 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace flux::fou {
+
+// The level of memory pressure reported by a `memory_pressure_monitor`.
+enum class memory_pressure : ::std::uint8_t {
+    // Nothing has to be done.
+    none,
+    // The process is close to its limit, caches should be released until the usage is acceptable.
+    moderate,
+    // The process is stalling on memory or has hit its limit, every cache should be released.
+    critical
+};
+
+// A snapshot of the pressure related kernel files, missing files leave their values at zero.
+struct [[nodiscard]] memory_pressure_sample final {
+    // The `avg10` percentages of the `some` and `full` lines of the PSI file.
+    float some_avg10 = 0.0f;
+    float full_avg10 = 0.0f;
+    // The cumulative counters of the cgroup `memory.events` file.
+    ::std::uint64_t high_events = 0u;
+    ::std::uint64_t max_events  = 0u;
+    ::std::uint64_t oom_events  = 0u;
+    // The cgroup `memory.current` and `memory.max` values, `limit` is zero if there is none.
+    ::std::uint64_t usage = 0u;
+    ::std::uint64_t limit = 0u;
+};
+
+// Where the monitor looks for its signals and when it reports pressure. The paths can be pointed to
+// fixture files, e.g. for testing, or to the cgroup of a container.
+struct [[nodiscard]] memory_pressure_config final {
+    // The PSI file, usually `/proc/pressure/memory` or `memory.pressure` inside of a cgroup.
+    char const* pressure_path = "/proc/pressure/memory";
+    // The cgroup v2 directory containing `memory.events`, `memory.current` and `memory.max`.
+    char const* cgroup_path = "/sys/fs/cgroup";
+
+    float some_avg10_threshold = 10.0f;
+    float full_avg10_threshold = 5.0f;
+    // The fractions of `memory.max` at which the usage is considered as moderate or critical.
+    float moderate_usage = 0.80f;
+    float critical_usage = 0.95f;
+};
+
+// Watches the Linux pressure stall information and the cgroup memory accounting of the process and
+// releases the cached memory of registered allocators once the pressure rises, so that we give
+// memory back before the OOM killer picks us. Targets are trimmed in ascending `priority` order:
+// under `moderate` pressure trimming stops as soon as the usage drops below the moderate limit,
+// under `critical` pressure every target is trimmed.
+// NOTE:
+//  The monitor does not start a thread and is not synchronized. `poll()` calls `shrink_to_fit()`
+//  on the registered allocators, which are not thread-safe in general, so it must be called from
+//  the thread owning them, e.g. once per frame or between jobs. Targets must be removed before
+//  they are destroyed.
+class [[nodiscard]] memory_pressure_monitor {
+public:
+    using size_type     = ::std::size_t;
+    using trim_function = void (*)(void* target) noexcept;
+
+    static constexpr size_type max_targets = 32u;
+
+    explicit memory_pressure_monitor(memory_pressure_config const& config = {}) noexcept;
+
+    memory_pressure_monitor(memory_pressure_monitor const&)            = delete;
+    memory_pressure_monitor& operator=(memory_pressure_monitor const&) = delete;
+
+    // Registers an allocator with a `shrink_to_fit()` or a `trim()` function, e.g. a
+    // `memory_arena`, `memory_stack`, `memory_pool`, `temporary_stack` or `memory_block_depot`.
+    // Returns `false` if there are already `max_targets` registered.
+    template <typename Target>
+    bool add(Target& target, int priority = 0) noexcept {
+        return add(static_cast<void*>(&target), &trim_target<Target>, priority);
+    }
+
+    bool add(void* target, trim_function trim, int priority = 0) noexcept;
+
+    // Unregisters a target, it does nothing if the target was never registered.
+    void remove(void const* target) noexcept;
+
+    // Reads the kernel files and classifies the pressure without trimming anything.
+    memory_pressure sample() noexcept;
+
+    // Samples the pressure and trims the registered targets accordingly, returns the sampled level.
+    memory_pressure poll() noexcept;
+
+    // Trims every registered target in priority order, regardless of the current pressure.
+    void trim_all() noexcept;
+
+    memory_pressure_sample const& last_sample() const noexcept {
+        return last_;
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    memory_pressure_config const& config() const noexcept {
+        return config_;
+    }
+
+private:
+    struct [[nodiscard]] entry final {
+        void*         object;
+        trim_function trim;
+        int           priority;
+    };
+
+    template <typename Target>
+    static void trim_target(void* object) noexcept {
+        auto& allocator = *static_cast<Target*>(object);
+        if constexpr (requires { allocator.shrink_to_fit(); }) {
+            allocator.shrink_to_fit();
+        } else {
+            allocator.trim();
+        }
+    }
+
+    memory_pressure classify(memory_pressure_sample const& sample) const noexcept;
+
+    ::std::uint64_t read_usage() const noexcept;
+
+    memory_pressure_config config_;
+    memory_pressure_sample last_;
+    entry                  targets_[max_targets];
+    size_type              size_;
+};
+
+} // namespace flux::fou
@@ -0,0 +1,106 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <list>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+using namespace flux;
+
+TEST_CASE("fou::memory_resource_adapter", "[flux-memory/memory_resource_adapter.hpp]") {
+    SECTION("stateful allocator") {
+        fou::memory_stack<>                               stack{4096u};
+        fou::memory_resource_adapter<fou::memory_stack<>> resource{stack};
+        auto const                                        capacity = stack.capacity();
+        ::std::pmr::vector<int>                           values{&resource};
+        for (int i = 0; i < 100; ++i) {
+            values.push_back(i);
+        }
+        CHECK(values.back() == 99);
+        CHECK(stack.capacity() < capacity);
+        CHECK(&resource.allocator() == &stack);
+    }
+
+    SECTION("node allocator") {
+        using memory_pool_list = fou::memory_pool_list<fou::node_pool, fou::log2_buckets>;
+
+        memory_pool_list                               pool{64u, 4096u};
+        fou::memory_resource_adapter<memory_pool_list> resource{pool};
+        ::std::pmr::list<::std::pmr::string>           strings{&resource};
+        for (int i = 0; i < 100; ++i) {
+            strings.emplace_back(::std::pmr::string(40u, 'a'));
+        }
+        CHECK(strings.size() == 100u);
+        CHECK(strings.back() == ::std::string_view{"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"});
+        CHECK(strings.back().get_allocator().resource() == &resource);
+    }
+
+    SECTION("stateless allocator") {
+        fou::memory_resource_adapter<fou::heap_allocator> resource;
+        ::std::pmr::vector<::std::uint64_t>               values{&resource};
+        values.resize(1000u, 7u);
+        CHECK(values[999] == 7u);
+
+        auto const alignment = fou::detail::max_alignment;
+        auto*      memory    = resource.allocate(256u, alignment);
+        CHECK(fou::is_aligned(memory, alignment));
+        resource.deallocate(memory, 256u, alignment);
+    }
+
+    SECTION("any allocator") {
+        fou::heap_allocator                              heap;
+        fou::memory_resource_adapter<fou::any_allocator> resource{heap};
+        ::std::pmr::vector<int>                          values{&resource};
+        values.resize(100u, 1);
+        CHECK(values[99] == 1);
+    }
+
+    SECTION("equality") {
+        fou::memory_resource_adapter<fou::heap_allocator> a;
+        fou::memory_resource_adapter<fou::heap_allocator> b;
+        CHECK(a == a);
+        CHECK(a != b);
+    }
+}
+
+TEST_CASE("fou::pmr_raw_allocator", "[flux-memory/memory_resource_adapter.hpp]") {
+    static_assert(fou::is_shared_allocator<fou::pmr_raw_allocator>::value);
+
+    alignas(16) ::std::byte               buffer[4096];
+    ::std::pmr::monotonic_buffer_resource monotonic{buffer, sizeof(buffer),
+                                                    ::std::pmr::null_memory_resource()};
+    fou::pmr_raw_allocator                allocator{&monotonic};
+    CHECK(allocator.resource() == &monotonic);
+    CHECK(allocator == fou::pmr_raw_allocator{&monotonic});
+    CHECK(!(allocator == fou::pmr_raw_allocator{}));
+
+    SECTION("flux container") {
+        fou::dynamic_array<int, fou::pmr_raw_allocator> values{allocator};
+        for (int i = 0; i < 100; ++i) {
+            values.push_back(i);
+        }
+        CHECK(values.back() == 99);
+
+        auto* const memory = reinterpret_cast<::std::byte*>(values.data());
+        CHECK((memory >= buffer && memory < buffer + sizeof(buffer)));
+    }
+
+    SECTION("std container") {
+        using std_allocator = fou::std_allocator_adapter<int, fou::pmr_raw_allocator>;
+
+        ::std::vector<int, std_allocator> values{std_allocator{allocator}};
+        values.resize(100u, 3);
+        CHECK(values[99] == 3);
+        CHECK(values.get_allocator() == std_allocator{allocator});
+    }
+
+    SECTION("round trip") {
+        fou::memory_resource_adapter<fou::pmr_raw_allocator> resource{allocator};
+        ::std::pmr::vector<int>                              values{&resource};
+        values.resize(100u, 5);
+        CHECK(values[99] == 5);
+        CHECK(resource.allocator().resource() == &monotonic);
+    }
+}
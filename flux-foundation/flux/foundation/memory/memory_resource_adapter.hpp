@@ -0,0 +1,123 @@
+#pragma once
+#include <flux/foundation/memory/std_allocator_adapter.hpp>
+
+#include <memory_resource>
+
+namespace flux::fou {
+
+// A `std::pmr::memory_resource` that allocates from a `RawAllocator`, so that `std::pmr`
+// containers and third-party code taking a `memory_resource` can use any flux allocator. It
+// stores an `allocator_reference`, so a stateful allocator must outlive it.
+// NOTE:
+//  Without RTTI, the type of another resource is unknown, so it only compares equal to itself.
+//  Alignments bigger than the `max_alignment()` of the allocator are not supported.
+template <raw_allocator RawAllocator>
+class [[nodiscard]] memory_resource_adapter final : public ::std::pmr::memory_resource,
+                                                    allocator_reference<RawAllocator> {
+    using allocator_reference = allocator_reference<RawAllocator>;
+
+    static constexpr bool is_any_reference      = detail::any_reference<allocator_reference>;
+    static constexpr bool is_stateful_allocator = fou::is_stateful_allocator<RawAllocator>::value;
+
+public:
+    using allocator_type = typename allocator_reference::allocator_type;
+
+    // clang-format off
+    memory_resource_adapter() noexcept requires(not is_stateful_allocator)
+            : allocator_reference{allocator_type{}} {}
+
+    explicit memory_resource_adapter(allocator_reference const& allocator) noexcept
+            : allocator_reference{allocator} {}
+
+    template <typename Allocator>
+        requires not_derived_from<Allocator, memory_resource_adapter>
+    explicit memory_resource_adapter(Allocator& allocator) noexcept
+            : allocator_reference{allocator} {}
+
+    template <typename Allocator>
+        requires not_derived_from<Allocator, memory_resource_adapter>
+    explicit memory_resource_adapter(Allocator const& allocator) noexcept
+            : allocator_reference{allocator} {}
+    // clang-format on
+
+    // Implicit conversion from any other `allocator_storage` is forbidden to prevent accidentally
+    // wrapping another `allocator_storage` inside the `allocator_reference`.
+    template <typename Storage, typename Mutex>
+    memory_resource_adapter(allocator_storage<Storage, Mutex>&) = delete;
+
+    decltype(auto) allocator() noexcept {
+        return allocator_reference::allocator();
+    }
+    decltype(auto) allocator() const noexcept {
+        return allocator_reference::allocator();
+    }
+
+private:
+    void* do_allocate(::std::size_t bytes, ::std::size_t alignment) noexcept override {
+        FLUX_ASSERT(alignment <= allocator_reference::max_alignment(),
+                    "the allocator does not support the alignment");
+        if constexpr (is_any_reference)
+            return allocator().allocate_node(bytes, alignment);
+        else
+            return allocator_reference::allocate_node(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, ::std::size_t bytes,
+                       ::std::size_t alignment) noexcept override {
+        if constexpr (is_any_reference)
+            allocator().deallocate_node(ptr, bytes, alignment);
+        else
+            allocator_reference::deallocate_node(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(::std::pmr::memory_resource const& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// A shared `RawAllocator` that allocates from a `std::pmr::memory_resource`, so that flux
+// containers can use resources from the standard library or from third-party code. Copies use
+// the same resource, which must outlive them.
+class [[nodiscard]] pmr_raw_allocator final {
+public:
+    using size_type       = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+    using stateful        = meta::true_type;
+
+    // Uses `std::pmr::get_default_resource()`.
+    pmr_raw_allocator() noexcept : resource_{::std::pmr::get_default_resource()} {}
+
+    explicit(false) pmr_raw_allocator(::std::pmr::memory_resource* resource) noexcept
+            : resource_{resource} {
+        FLUX_ASSERT(resource_);
+    }
+
+    void* allocate_node(size_type size, size_type alignment) noexcept {
+        return resource_->allocate(size, alignment);
+    }
+
+    void deallocate_node(void* node, size_type size, size_type alignment) noexcept {
+        resource_->deallocate(node, size, alignment);
+    }
+
+    // A `memory_resource` accepts any alignment that is a power of two.
+    size_type max_alignment() const noexcept {
+        return size_type{1u} << (::std::numeric_limits<size_type>::digits - 1);
+    }
+
+    ::std::pmr::memory_resource* resource() const noexcept {
+        return resource_;
+    }
+
+    friend bool operator==(pmr_raw_allocator const& lhs, pmr_raw_allocator const& rhs) noexcept {
+        return *lhs.resource_ == *rhs.resource_;
+    }
+
+private:
+    ::std::pmr::memory_resource* resource_;
+};
+
+template <>
+struct [[nodiscard]] is_shared_allocator<pmr_raw_allocator> : meta::true_type {};
+
+} // namespace flux::fou
@@ -32,6 +32,16 @@ TEST_CASE("fou::memory_stack", "[flux-memory/memory_stack.hpp]") {
         CHECK_FALSE(m0 == m1);
     }
 
+    SECTION("reserve") {
+        CHECK(stack.reserve(1000u));
+        auto const allocated = allocator.allocated_count();
+        CHECK(allocated > 1u);
+
+        stack.allocate(200u, 1u);
+        stack.allocate(200u, 1u);
+        CHECK(allocator.allocated_count() == allocated);
+    }
+
     SECTION("normal allocation/unwind") {
         stack.allocate(10u, 1u);
         CHECK(stack.capacity() == capacity - 10 - 2 * detail::debug_fence_size);
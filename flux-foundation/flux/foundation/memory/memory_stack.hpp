@@ -79,6 +79,13 @@ struct memory_stack : default_leak_detector<detail::memory_stack_leak_handler> {
         return stack_.allocate(end(), size, alignment);
     }
 
+    // Grows `memory` from `size` to `new_size` bytes if it is the last allocation and the current
+    // block has enough room left, it never shrinks.
+    constexpr bool try_expand(void* memory, size_type size, size_type new_size) noexcept {
+        FLUX_ASSERT(new_size >= size);
+        return stack_.try_expand(end(), memory, size, new_size);
+    }
+
     constexpr marker top() const noexcept {
         return {arena_.size() - 1u, stack_, end()};
     }
@@ -116,6 +123,11 @@ struct memory_stack : default_leak_detector<detail::memory_stack_leak_handler> {
         arena_.shrink_to_fit();
     }
 
+    // Allocates blocks ahead of time, see `memory_arena::reserve()`.
+    constexpr bool reserve(size_type bytes, prefault_mode mode = prefault_mode::touch) noexcept {
+        return arena_.reserve(bytes, mode);
+    }
+
     constexpr size_type capacity() const noexcept {
         return static_cast<size_type>(end() - stack_.top());
     }
@@ -219,7 +231,7 @@ struct [[nodiscard]] allocator_traits<memory_stack<BlockAllocator>> final {
     using allocator_type  = memory_stack<BlockAllocator>;
     using size_type       = typename allocator_type::size_type;
     using difference_type = typename allocator_type::difference_type;
-    using is_stateful     = ::std::true_type;
+    using stateful        = meta::true_type;
 
     static constexpr void*
     allocate_node(allocator_type& allocator,
@@ -261,6 +273,39 @@ struct [[nodiscard]] allocator_traits<memory_stack<BlockAllocator>> final {
         deallocate_node(allocator, array, count * size, alignment);
     }
 
+    static constexpr memory_block
+    allocate_at_least(allocator_type& allocator,
+                      size_type       size     ,
+                      size_type       alignment) noexcept
+    {
+        return {allocate_node(allocator, size, alignment), size};
+    }
+
+    static constexpr bool
+    try_expand(allocator_type& allocator,
+               void*           node     ,
+               size_type       size     ,
+               size_type       new_size ,
+               size_type       alignment) noexcept
+    {
+        (void)alignment;
+        if (!allocator.try_expand(node, size, new_size))
+            return false;
+        allocator.on_allocate(new_size - size);
+        return true;
+    }
+
+    static constexpr void*
+    try_reallocate(allocator_type& allocator,
+                   void*           node     ,
+                   size_type       size     ,
+                   size_type       new_size ,
+                   size_type       alignment) noexcept
+    {
+        (void)allocator, (void)node, (void)size, (void)new_size, (void)alignment;
+        return nullptr;
+    }
+
     static constexpr size_type max_node_size(allocator_type const& allocator) noexcept {
         return allocator.next_capacity();
     }
@@ -286,7 +331,10 @@ struct [[nodiscard]] composable_traits<memory_stack<BlockAllocator>> final {
                       size_type       size     ,
                       size_type       alignment) noexcept
     {
-        return allocator.try_allocate(size, alignment);
+        auto* memory = allocator.try_allocate(size, alignment);
+        if (memory)
+            allocator.on_allocate(size);
+        return memory;
     }
 
     static constexpr void*
@@ -295,7 +343,7 @@ struct [[nodiscard]] composable_traits<memory_stack<BlockAllocator>> final {
                        size_type       size     ,
                        size_type       alignment) noexcept
     {
-        return allocator.try_allocate(count * size, alignment);
+        return try_allocate_node(allocator, count * size, alignment);
     }
 
     static constexpr bool
@@ -304,9 +352,11 @@ struct [[nodiscard]] composable_traits<memory_stack<BlockAllocator>> final {
                         size_type       size     ,
                         size_type       alignment) noexcept
     {
-        (void)size;
         (void)alignment;
-        return allocator.arena_.contains(node);
+        if (!allocator.arena_.contains(node))
+            return false;
+        allocator.on_deallocate(size);
+        return true;
     }
 
     static constexpr bool
@@ -0,0 +1,80 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace flux;
+using namespace flux::fou;
+
+namespace {
+
+struct tracked {
+    tracked(::std::vector<int>& list, int value) noexcept : destroyed{&list}, id{value} {}
+
+    ~tracked() {
+        destroyed->push_back(id);
+    }
+
+    ::std::vector<int>* destroyed;
+    int                 id;
+};
+
+struct alignas(64) over_aligned {
+    ~over_aligned() {}
+
+    int value = 0;
+};
+
+} // namespace
+
+TEST_CASE("fou::object_arena", "[flux-memory/object_arena.hpp]") {
+    ::std::vector<int> destroyed;
+
+    object_arena<> arena{4096u};
+
+    auto const a = arena.create<tracked>(destroyed, 1);
+    auto const i = arena.create<int>(42);
+    auto const b = arena.create<tracked>(destroyed, 2);
+    CHECK(a->id == 1);
+    CHECK(*i == 42);
+    CHECK(b->id == 2);
+
+    auto const aligned = arena.create<over_aligned>();
+    CHECK(is_aligned(aligned, 64u));
+    aligned->value = 3;
+
+    SECTION("unwind") {
+        auto const marker = arena.top();
+        (void)arena.create<tracked>(destroyed, 3);
+        (void)arena.create<::std::string>(::std::string(1000u, 'a'));
+        (void)arena.create<tracked>(destroyed, 4);
+
+        arena.unwind(marker);
+        CHECK(destroyed == ::std::vector<int>{4, 3});
+        CHECK(b->id == 2);
+
+        {
+            memory_stack_unwinder<object_arena<>> unwinder{arena};
+            (void)arena.create<tracked>(destroyed, 5);
+        }
+        CHECK(destroyed == ::std::vector<int>{4, 3, 5});
+    }
+    SECTION("reset") {
+        arena.reset();
+        CHECK(destroyed == ::std::vector<int>{2, 1});
+
+        auto const c = arena.create<tracked>(destroyed, 6);
+        CHECK(c->id == 6);
+    }
+    SECTION("many blocks") {
+        for (auto n = 0; n < 1000; ++n)
+            (void)arena.create<tracked>(destroyed, 10 + n);
+
+        arena.reset();
+        REQUIRE(destroyed.size() == 1002u);
+        CHECK(destroyed.front() == 1009);
+        CHECK(destroyed.back() == 1);
+    }
+}
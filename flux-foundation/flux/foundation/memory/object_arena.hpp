@@ -0,0 +1,119 @@
+#pragma once
+#include <flux/foundation/memory/memory_stack.hpp>
+
+#include <algorithm>
+#include <memory>
+
+namespace flux::fou {
+
+namespace detail {
+
+// Allocated right before a non-trivially destructible object of an `object_arena`, it links the
+// objects in the reverse order of their construction.
+struct [[nodiscard]] object_arena_destructor final {
+    object_arena_destructor* next;
+    void (*destroy)(object_arena_destructor*) noexcept;
+};
+
+template <typename T>
+inline constexpr ::std::size_t object_arena_offset =
+        sizeof(object_arena_destructor) + align_offset(sizeof(object_arena_destructor), alignof(T));
+
+template <typename T>
+void destroy_arena_object(object_arena_destructor* destructor) noexcept {
+    auto const object = reinterpret_cast<::std::byte*>(destructor) + object_arena_offset<T>;
+    ::std::destroy_at(fou::launder(reinterpret_cast<T*>(object)));
+}
+
+} // namespace detail
+
+// Constructs objects of any type in a `memory_stack` and destroys them in bulk. Trivially
+// destructible objects are only bump allocated, the others are preceded by a record of two
+// pointers that links them into a list of destructors. `unwind()` and `reset()` walk that list
+// once, destroying the objects in the reverse order of their construction, before unwinding the
+// stack. It is a `stack` for `memory_stack_unwinder`, so a scope can destroy what it created:
+//  object_arena<>                       arena{block_size};
+//  memory_stack_unwinder<object_arena<>> unwinder{arena};
+// NOTE:
+//  It is not thread-safe, and the objects must not be destroyed by other means.
+template <typename BlockOrRawAllocator = default_allocator>
+class [[nodiscard]] object_arena {
+    using destructor_type = detail::object_arena_destructor;
+
+public:
+    using stack_type     = memory_stack<BlockOrRawAllocator>;
+    using allocator_type = typename stack_type::allocator_type;
+    using size_type      = typename stack_type::size_type;
+
+    struct [[nodiscard]] marker final {
+        typename stack_type::marker stack;
+        destructor_type*            destructors;
+    };
+
+    // The stack gets blocks of `block_size` bytes, the `args` are forwarded to its block
+    // allocator.
+    template <typename... Args>
+    explicit object_arena(size_type block_size, Args&&... args)
+            : stack_{block_size, ::std::forward<Args>(args)...}, first_{stack_.top(), nullptr} {}
+
+    object_arena(object_arena const&)            = delete;
+    object_arena& operator=(object_arena const&) = delete;
+
+    ~object_arena() {
+        reset();
+    }
+
+    // Constructs a `T` from the `args`, it lives until the arena unwinds past it.
+    template <typename T, typename... Args>
+        requires(meta::object<T> and meta::nothrow_constructible<T, Args...>)
+    T* create(Args&&... args) noexcept {
+        if constexpr (meta::trivially_destructible<T>) {
+            auto const memory = stack_.allocate(sizeof(T), alignof(T));
+            return ::std::construct_at(static_cast<T*>(memory), ::std::forward<Args>(args)...);
+        } else {
+            constexpr auto alignment = ::std::max(alignof(T), alignof(destructor_type));
+            auto const memory = static_cast<::std::byte*>(
+                    stack_.allocate(detail::object_arena_offset<T> + sizeof(T), alignment));
+            auto const object = ::std::construct_at(
+                    reinterpret_cast<T*>(memory + detail::object_arena_offset<T>),
+                    ::std::forward<Args>(args)...);
+
+            // Linked once constructed, so that an object is never destroyed while being built.
+            destructors_ = ::std::construct_at(reinterpret_cast<destructor_type*>(memory),
+                                               destructors_, &detail::destroy_arena_object<T>);
+            return object;
+        }
+    }
+
+    marker top() const noexcept {
+        return {stack_.top(), destructors_};
+    }
+
+    // Destroys the objects created since `top()` returned the `stack_marker`, the most recent one
+    // first, then unwinds the stack to it.
+    void unwind(marker stack_marker) noexcept {
+        while (destructors_ != stack_marker.destructors) {
+            FLUX_ASSERT(destructors_, "the marker is above the top of the arena");
+            auto const destructor = destructors_;
+            destructors_          = destructor->next;
+            destructor->destroy(destructor);
+        }
+        stack_.unwind(stack_marker.stack);
+    }
+
+    // Destroys every object, the first block of the stack is kept.
+    void reset() noexcept {
+        unwind(first_);
+    }
+
+    stack_type const& stack() const noexcept {
+        return stack_;
+    }
+
+private:
+    stack_type       stack_;
+    marker           first_;
+    destructor_type* destructors_ = nullptr;
+};
+
+} // namespace flux::fou
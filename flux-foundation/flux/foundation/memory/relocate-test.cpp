@@ -49,6 +49,54 @@ struct C : B {
 };
 static_assert(meta::trivially_copyable<A> and meta::trivially_relocatable<C>);
 
+// Owns an `int` like a `unique_ptr`, it is not trivially copyable but opts in to relocation.
+struct owner {
+    using trivially_relocatable = meta::true_type;
+
+    static inline int destroyed = 0;
+
+    explicit owner(int value) noexcept : value{new int{value}} {}
+    owner(owner&& other) noexcept : value{::std::exchange(other.value, nullptr)} {}
+    ~owner() {
+        if (value) {
+            ++destroyed;
+            delete value;
+        }
+    }
+
+    int* value;
+};
+static_assert(not meta::trivially_copyable<owner> and meta::trivially_relocatable<owner>);
+static_assert(meta::trivially_relocatable<owner const>);
+static_assert(meta::trivially_relocatable<owner[4]>);
+static_assert(meta::trivially_relocatable<::std::pair<owner, int>>);
+static_assert(meta::trivially_relocatable<::std::tuple<int, owner, owner>>);
+static_assert(meta::trivially_relocatable<::std::array<owner, 4>>);
+
+struct opted_out {
+    using trivially_relocatable = meta::false_type;
+
+    opted_out() noexcept = default;
+    opted_out(opted_out&&) noexcept {}
+};
+static_assert(meta::relocatable<opted_out> and not meta::trivially_relocatable<opted_out>);
+static_assert(not meta::trivially_relocatable<::std::pair<owner, opted_out>>);
+
+// Registers itself by address, it must never be relocated by copying its bytes.
+struct self_referencing {
+    self_referencing() noexcept : self{this} {}
+    self_referencing(self_referencing&&) noexcept : self{this} {}
+    ~self_referencing() {}
+
+    self_referencing* self;
+};
+static_assert(not meta::trivially_relocatable<self_referencing>);
+static_assert(not meta::trivially_relocatable<::std::tuple<self_referencing>>);
+
+static_assert(meta::memrelocatable<owner*, owner*>);
+static_assert(not meta::memrelocatable<owner const*, owner*>);
+static_assert(not meta::memrelocatable<self_referencing*, self_referencing*>);
+
 TEST_CASE("fou::relocate_at", "[flux-memory/relocate.hpp]") {
     SECTION("trivially copyable/relocatable at run-time (std::memmove)") {
         C  c1 = {{{1}, 2, 3}, 4};
@@ -77,4 +125,60 @@ TEST_CASE("fou::relocate_at", "[flux-memory/relocate.hpp]") {
         // After relocate_at
         CHECK(4 == c1.sc);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("fou::uninitialized_relocate", "[flux-memory/relocate.hpp]") {
+    SECTION("trivially relocatable by opt-in") {
+        owner::destroyed = 0;
+        alignas(owner) unsigned char src[4 * sizeof(owner)];
+        alignas(owner) unsigned char dest[4 * sizeof(owner)];
+
+        auto* first = reinterpret_cast<owner*>(src);
+        for (int i = 0; i < 4; ++i)
+            ::std::construct_at(first + i, i);
+
+        auto* result = reinterpret_cast<owner*>(dest);
+        auto* last   = fou::ranges::uninitialized_relocate(first, first + 4, result);
+        CHECK(last == result + 4);
+        // Neither a move constructor nor a destructor has run.
+        CHECK(owner::destroyed == 0);
+        for (int i = 0; i < 4; ++i)
+            CHECK(*result[i].value == i);
+
+        ::std::destroy(result, last);
+        CHECK(owner::destroyed == 4);
+    }
+
+    SECTION("overlapping ranges") {
+        owner::destroyed = 0;
+        alignas(owner) unsigned char storage[6 * sizeof(owner)];
+
+        auto* first = reinterpret_cast<owner*>(storage);
+        for (int i = 0; i < 4; ++i)
+            ::std::construct_at(first + i, i);
+
+        auto const result = fou::ranges::uninitialized_relocate(first, first + 4, first + 2,
+                                                                first + 6);
+        CHECK(result.in == first + 4);
+        CHECK(result.out == first + 6);
+        for (int i = 0; i < 4; ++i)
+            CHECK(*first[i + 2].value == i);
+
+        ::std::destroy(first + 2, first + 6);
+        CHECK(owner::destroyed == 4);
+    }
+
+    SECTION("not trivially relocatable") {
+        alignas(self_referencing) unsigned char src[2 * sizeof(self_referencing)];
+        alignas(self_referencing) unsigned char dest[2 * sizeof(self_referencing)];
+
+        auto* first = reinterpret_cast<self_referencing*>(src);
+        ::std::uninitialized_default_construct(first, first + 2);
+
+        auto* result = reinterpret_cast<self_referencing*>(dest);
+        fou::ranges::uninitialized_relocate_no_overlap(first, first + 2, result);
+        CHECK(result[0].self == &result[0]);
+        CHECK(result[1].self == &result[1]);
+        ::std::destroy(result, result + 2);
+    }
+}
@@ -17,8 +17,8 @@ template <typename T, typename U>
     requires meta::relocatable_from<T, U>
 constexpr U* relocate_at(T* const src, U* const dest) noexcept {
     if constexpr (meta::same_trivially_relocatable<T, U>) {
-        detail::constexpr_memmove(dest, src);
-        return launder(dest); // required?
+        detail::constexpr_relocate(dest, src);
+        return fou::launder(dest); // required?
     } else {
         destroy_guard<T> guard{src};
         return detail::construct_at(dest, ::std::move(*src));
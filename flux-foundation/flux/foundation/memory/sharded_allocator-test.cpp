@@ -0,0 +1,86 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <thread>
+#include <vector>
+
+using namespace flux::fou;
+
+TEST_CASE("fou::sharded_allocator", "[flux-memory/sharded_allocator.hpp]") {
+    using memory_pool       = flux::fou::memory_pool<>;
+    using sharded_allocator = flux::fou::sharded_allocator<memory_pool, 4u>;
+    using allocator_traits  = flux::fou::allocator_traits<sharded_allocator>;
+
+    constexpr auto node_size  = 16u;
+    constexpr auto node_count = 64u;
+
+    sharded_allocator allocator{node_size, memory_pool::min_block_size(node_size, node_count)};
+    CHECK(allocator_traits::max_node_size(allocator) == node_size);
+
+    auto const capacity = allocator.guard(0u)->capacity();
+    auto const own      = sharded_allocator::shard_index();
+    CHECK(own == sharded_allocator::shard_index());
+
+    SECTION("shard of the thread") {
+        auto* node = allocator.allocate_node(node_size, 8u);
+        CHECK(allocator.guard(own)->capacity() == capacity - node_size);
+        allocator.deallocate_node(node, node_size, 8u);
+        CHECK(allocator.guard(own)->capacity() == capacity);
+    }
+    SECTION("freed by another thread") {
+        // Threads get consecutive shards, so the next thread allocates from another shard.
+        sharded_allocator::size_type other = own;
+        void*                        node  = nullptr;
+        ::std::thread{[&] {
+            other = sharded_allocator::shard_index();
+            node  = allocator.allocate_node(node_size, 8u);
+        }}.join();
+        REQUIRE(other != own);
+        CHECK(allocator.guard(other)->capacity() == capacity - node_size);
+
+        allocator.deallocate_node(node, node_size, 8u);
+        CHECK(allocator.guard(other)->capacity() == capacity);
+        CHECK(allocator.guard(own)->capacity() == capacity);
+    }
+    SECTION("concurrent") {
+        constexpr auto thread_count = 8u;
+        constexpr auto iterations   = 1000u;
+
+        // Every thread frees the nodes of its neighbour, so that frees cross shards.
+        ::std::vector<::std::vector<void*>> nodes(thread_count);
+        ::std::vector<::std::thread>        threads;
+        for (auto t = 0u; t < thread_count; ++t) {
+            threads.emplace_back([&, t] {
+                for (auto i = 0u; i < iterations; ++i)
+                    nodes[t].push_back(allocator.allocate_node(node_size, 8u));
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+        threads.clear();
+        for (auto t = 0u; t < thread_count; ++t) {
+            threads.emplace_back([&, t] {
+                for (auto* node : nodes[(t + 1u) % thread_count])
+                    allocator.deallocate_node(node, node_size, 8u);
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        for (auto i = 0u; i < sharded_allocator::shard_count; ++i)
+            CHECK(allocator.guard(i)->capacity() >= capacity);
+    }
+}
+
+TEST_CASE("fou::sharded_allocator memory_stack", "[flux-memory/sharded_allocator.hpp]") {
+    using memory_stack      = flux::fou::memory_stack<>;
+    using sharded_allocator = flux::fou::sharded_allocator<memory_stack, 2u, spin_mutex>;
+
+    sharded_allocator allocator{memory_stack::min_block_size(1024u)};
+
+    auto* node = allocator.allocate_node(64u, 8u);
+    CHECK(node);
+    CHECK(allocator.guard(sharded_allocator::shard_index())->capacity() < 1024u);
+    allocator.deallocate_node(node, 64u, 8u);
+}
@@ -0,0 +1,162 @@
+#pragma once
+#include <flux/foundation/concurrency/mutex.hpp>
+#include <flux/foundation/memory/threading.hpp>
+
+#include <atomic>
+#include <utility>
+
+namespace flux::fou {
+
+namespace detail {
+
+// Numbers the threads in the order in which they first use a `sharded_allocator`, so that
+// consecutive threads get different shards.
+inline ::std::size_t thread_shard_index() noexcept {
+    static ::std::atomic<::std::size_t> next{0u};
+    thread_local auto const             index = next.fetch_add(1u, ::std::memory_order_relaxed);
+    return index;
+}
+
+// clang-format off
+template <typename Allocator>
+concept shardable_allocator =
+    requires(Allocator& allocator, void* ptr, ::std::size_t size) {
+        { composable_traits<Allocator>::try_deallocate_node(allocator, ptr, size, size) }
+            -> meta::same_as<bool>;
+    };
+// clang-format on
+
+} // namespace detail
+
+// A thread-safe `RawAllocator` made of `Shards` independent instances of a stateful allocator,
+// e.g. a `memory_pool` or a `memory_stack`, each behind its own `Mutex`. A thread always allocates
+// from the same shard, so threads only contend when there are more of them than shards.
+// Memory may be freed by any thread, it is returned to the shard that owns it, which is found
+// with `composable_traits::try_deallocate_node()`, starting with the shard of the calling thread.
+// NOTE:
+//  Finding the owner of memory allocated by another thread asks the shards one after the other, so
+//  it is slower than freeing memory of the own shard.
+// clang-format off
+template <
+    raw_allocator RawAllocator,
+    ::std::size_t Shards,
+    lockable      Mutex = adaptive_mutex
+>
+    requires(Shards > 0u and
+             detail::shardable_allocator<typename allocator_traits<RawAllocator>::allocator_type>)
+// clang-format on
+class [[nodiscard]] sharded_allocator {
+    using allocator_traits  = allocator_traits<RawAllocator>;
+    using composable_traits = composable_traits<typename allocator_traits::allocator_type>;
+
+public:
+    using allocator_type  = typename allocator_traits::allocator_type;
+    using mutex_type      = Mutex;
+    using size_type       = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+    using stateful        = meta::true_type;
+
+    static constexpr size_type shard_count = Shards;
+
+    // Constructs every shard with the same `args`.
+    template <typename... Args>
+        requires meta::constructible<allocator_type, Args const&...>
+    explicit sharded_allocator(Args const&... args) noexcept
+            : sharded_allocator{::std::make_index_sequence<Shards>{}, args...} {}
+
+    sharded_allocator(sharded_allocator const&)            = delete;
+    sharded_allocator& operator=(sharded_allocator const&) = delete;
+
+    void* allocate_node(size_type size, size_type alignment) noexcept {
+        auto&               shard = current_shard();
+        lock_guard_t<Mutex> guard{shard.mutex};
+        return allocator_traits::allocate_node(shard.allocator, size, alignment);
+    }
+
+    void* allocate_array(size_type count, size_type size, size_type alignment) noexcept {
+        auto&               shard = current_shard();
+        lock_guard_t<Mutex> guard{shard.mutex};
+        return allocator_traits::allocate_array(shard.allocator, count, size, alignment);
+    }
+
+    void deallocate_node(void* node, size_type size, size_type alignment) noexcept {
+        [[maybe_unused]] auto const found = for_each_shard([&](allocator_type& allocator) {
+            return composable_traits::try_deallocate_node(allocator, node, size, alignment);
+        });
+        FLUX_ASSERT(found, "memory was not allocated by the sharded_allocator");
+    }
+
+    void deallocate_array(void* array, size_type count, size_type size,
+                          size_type alignment) noexcept {
+        [[maybe_unused]] auto const found = for_each_shard([&](allocator_type& allocator) {
+            return composable_traits::try_deallocate_array(allocator, array, count, size,
+                                                           alignment);
+        });
+        FLUX_ASSERT(found, "memory was not allocated by the sharded_allocator");
+    }
+
+    size_type max_node_size() const noexcept {
+        return allocator_traits::max_node_size(shards_[0].allocator);
+    }
+
+    size_type max_array_size() const noexcept {
+        return allocator_traits::max_array_size(shards_[0].allocator);
+    }
+
+    size_type max_alignment() const noexcept {
+        return allocator_traits::max_alignment(shards_[0].allocator);
+    }
+
+    // Returns the index of the shard the calling thread allocates from.
+    static size_type shard_index() noexcept {
+        return detail::thread_shard_index() % Shards;
+    }
+
+    // Locks the shard at `index` and gives access to its allocator while the result is alive.
+    auto guard(size_type index) noexcept {
+        FLUX_ASSERT(index < Shards);
+        auto& shard = shards_[index];
+        return detail::lock_allocator(shard.allocator, shard.mutex);
+    }
+
+private:
+    struct [[nodiscard]] alignas(cache_line_size) shard_type final {
+        template <typename... Args>
+        explicit shard_type(Args const&... args) noexcept : allocator{args...} {}
+
+        Mutex          mutex;
+        allocator_type allocator;
+    };
+
+    template <::std::size_t... Indices, typename... Args>
+    explicit sharded_allocator(::std::index_sequence<Indices...>, Args const&... args) noexcept
+            : shards_{make_shard<Indices>(args...)...} {}
+
+    // The shards are neither copyable nor movable, they are initialized in place from the result.
+    template <::std::size_t, typename... Args>
+    static shard_type make_shard(Args const&... args) noexcept {
+        return shard_type{args...};
+    }
+
+    shard_type& current_shard() noexcept {
+        return shards_[shard_index()];
+    }
+
+    // Calls `f` with the allocator of every shard, starting with the one of the calling thread,
+    // until it returns `true`. Returns `false` if it never did.
+    template <typename F>
+    bool for_each_shard(F&& f) noexcept {
+        auto const first = shard_index();
+        for (size_type i = 0u; i < Shards; ++i) {
+            auto&               shard = shards_[(first + i) % Shards];
+            lock_guard_t<Mutex> guard{shard.mutex};
+            if (f(shard.allocator))
+                return true;
+        }
+        return false;
+    }
+
+    shard_type shards_[Shards];
+};
+
+} // namespace flux::fou
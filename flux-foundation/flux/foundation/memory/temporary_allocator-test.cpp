@@ -2,6 +2,8 @@
 
 #include <catch2/catch.hpp>
 
+#include <thread>
+
 using namespace flux;
 
 template <typename T>
@@ -25,4 +27,97 @@ TEST_CASE("fou::temporary_allocator", "[flux-memory/temporary_allocator.hpp]") {
         v.push_back(2023);
         CHECK(2023 == v[0]);
     }
-}
\ No newline at end of file
+}
+
+#if FLUX_MEMORY_TEMPORARY_STACK_MODE >= 2
+TEST_CASE("fou::temporary_stack reuse", "[flux-memory/temporary_allocator.hpp]") {
+    fou::temporary_stack* first = nullptr;
+    ::std::thread{[&] {
+        fou::temporary_allocator allocator;
+        first = &allocator.stack();
+        CHECK(allocator.allocate(6u * 1024u, alignof(int)));
+    }}.join();
+
+    // The stack released on thread exit is handed to the next thread.
+    fou::temporary_stack* second = nullptr;
+    ::std::thread{[&] { second = &fou::get_temporary_stack(); }}.join();
+    CHECK(first == second);
+
+    // The initializer releases the stack, a later request in the same thread acquires it again.
+    fou::temporary_stack* initialized = nullptr;
+    fou::temporary_stack* acquired    = nullptr;
+    ::std::thread{[&] {
+        {
+            fou::temporary_stack_initializer initializer;
+            initialized = &fou::get_temporary_stack();
+        }
+        acquired = &fou::get_temporary_stack();
+    }}.join();
+    CHECK(initialized == first);
+    CHECK(acquired == initialized);
+
+    // A released stack is only handed to a thread that asks for blocks no bigger than its own.
+    fou::temporary_stack* bigger = nullptr;
+    ::std::thread{[&] { bigger = &fou::get_temporary_stack(1024u * 1024u); }}.join();
+    CHECK(bigger != first);
+}
+#endif
+
+namespace {
+::std::size_t growth_count = 0u;
+
+void count_growth(::std::size_t) noexcept {
+    ++growth_count;
+}
+} // namespace
+
+TEST_CASE("fou::temporary_stack tuning", "[flux-memory/temporary_allocator.hpp]") {
+    fou::temporary_stack stack{1024u};
+    stack.growth_tracker(count_growth);
+    stack.decay_period(4u);
+
+    auto stats = stack.stats();
+    CHECK(stats.peak == 0u);
+    CHECK(stats.capacity == 1024u - fou::detail::memory_block_stack::offset());
+    CHECK(stats.block_count == 1u);
+    CHECK(stats.allocation_count == 1u);
+    CHECK(stats.resize_count == 0u);
+
+    auto const use = [&](::std::size_t size) {
+        fou::temporary_allocator allocator{stack};
+        CHECK(allocator.allocate(size, 8u));
+        {
+            fou::temporary_allocator nested{stack};
+            CHECK(nested.allocate(size, 8u));
+        }
+    };
+
+    // The scope spills into a second block, so the stack is resized to fit it.
+    growth_count = 0u;
+    use(800u);
+    stats = stack.stats();
+    CHECK(growth_count == 1u);
+    CHECK(stats.peak >= 1600u);
+    CHECK(stats.capacity >= stats.peak);
+    CHECK(stats.block_count == 1u);
+    CHECK(stats.resize_count == 1u);
+
+    // Steady state doesn't allocate any blocks.
+    auto const allocations = stats.allocation_count;
+    for (auto i = 0u; i < 3u; ++i)
+        use(800u);
+    CHECK(stack.stats().allocation_count == allocations);
+    CHECK(growth_count == 1u);
+
+    // The window still contains the big scopes.
+    use(16u);
+    CHECK(stack.stats().resize_count == 1u);
+
+    // A whole window of small scopes shrinks the stack back to its initial size.
+    for (auto i = 0u; i < 4u; ++i)
+        use(16u);
+    stats = stack.stats();
+    CHECK(stats.resize_count == 2u);
+    CHECK(stats.capacity == 1024u - fou::detail::memory_block_stack::offset());
+    CHECK(stats.peak >= 1600u);
+}
@@ -2,6 +2,9 @@
 
 #include <flux/foundation/memory/default_allocator.hpp>
 
+#include <algorithm>
+#include <atomic>
+
 namespace flux::fou {
 
 namespace {
@@ -29,6 +32,12 @@ auto temporary_block_allocator::growth_tracker() noexcept -> growth_tracker_type
 }
 
 auto temporary_block_allocator::allocate_block() noexcept -> memory_block {
+    if (block_count_ > 0u)
+        tracker_(block_size_);
+    ++block_count_;
+    ++allocation_count_;
+    reserved_size_ += block_size_;
+
     auto allocator = temporary_allocator_impl{};
     auto memory    = allocator_traits<temporary_allocator_impl>::allocate_array(
             allocator, block_size_, 1u, detail::max_alignment);
@@ -38,6 +47,9 @@ auto temporary_block_allocator::allocate_block() noexcept -> memory_block {
 }
 
 void temporary_block_allocator::deallocate_block(memory_block block) noexcept {
+    --block_count_;
+    reserved_size_ -= block.size;
+
     auto allocator = temporary_allocator_impl{};
     allocator_traits<temporary_allocator_impl>::deallocate_array(
             allocator, block.memory, block.size, 1u, detail::max_alignment);
@@ -55,6 +67,7 @@ void temporary_block_allocator::deallocate_block(memory_block block) noexcept {
 //  but not the stack itself destroyed.
 static struct [[nodiscard]] temporary_list {
     ::std::atomic<temporary_list_node*> first;
+    ::std::atomic<temporary_list_node*> free;
 
     // clang-format off
     temporary_stack* construct(::std::size_t size) noexcept {
@@ -64,31 +77,57 @@ static struct [[nodiscard]] temporary_list {
     }
     // clang-format on
 
-    temporary_stack* find_unused() noexcept {
-        for (auto ptr = first.load(); ptr; ptr = ptr->next_) {
-            auto value = false;
-            if (ptr->in_use_.compare_exchange_strong(value, true)) {
-                return static_cast<temporary_stack*>(ptr);
+    // Pushes the chain from `head` to `tail` onto the free stack. A push only depends on the head
+    // it has linked to still being the head, so it is not affected by the ABA problem.
+    void push_free(temporary_list_node* head, temporary_list_node* tail) noexcept {
+        auto* expected = free.load(::std::memory_order_relaxed);
+        do {
+            tail->next_free_ = expected;
+        } while (!free.compare_exchange_weak(expected, head, ::std::memory_order_release,
+                                             ::std::memory_order_relaxed));
+    }
+
+    // Pops a released stack. It takes the whole free stack at once, so no other thread can pop and
+    // re-push a node between our load and CAS, and gives back the remainder. The remainder is only
+    // walked if another thread has released a stack in the meantime.
+    temporary_stack* pop_free() noexcept {
+        auto* head = free.exchange(nullptr, ::std::memory_order_acquire);
+        if (!head)
+            return nullptr;
+
+        if (auto* rest = ::std::exchange(head->next_free_, nullptr)) {
+            temporary_list_node* expected = nullptr;
+            if (!free.compare_exchange_strong(expected, rest, ::std::memory_order_release,
+                                              ::std::memory_order_relaxed)) {
+                auto* tail = rest;
+                while (tail->next_free_)
+                    tail = tail->next_free_;
+                push_free(rest, tail);
             }
         }
-        return nullptr;
+        return static_cast<temporary_stack*>(head);
     }
 
+    // Reuses a released stack, which keeps the block size it has grown to, or creates a new one.
+    // A released stack whose next block would be smaller than `size` is given back, so a thread
+    // asking for a big stack never gets a small one.
     temporary_stack* create(::std::size_t size) noexcept {
-        if (auto ptr = find_unused()) {
-            FLUX_ASSERT(ptr->in_use_);
-            ptr->stack_ = temporary_block_stack{size};
-            return ptr;
+        if (auto ptr = pop_free()) {
+            if (ptr->next_capacity() + detail::memory_block_stack::offset() >= size)
+                return ptr;
+            push_free(ptr, ptr);
         }
         return construct(size);
     }
 
+    // Releases the memory of the stack and makes it available to other threads.
     void clear(temporary_stack& stack) noexcept {
         stack.stack_.shrink_to_fit();
-        stack.in_use_ = false;
+        push_free(&stack, &stack);
     }
 
     void destroy() noexcept {
+        free.store(nullptr);
         for (auto ptr = first.exchange(nullptr); ptr;) {
             auto stack = static_cast<temporary_stack*>(ptr);
             auto next  = ptr->next_;
@@ -113,19 +152,23 @@ thread_local struct thread_exit_detector_t {
             // clear automatically on thread exit, as the initializer's destructor does
             // note: if another's thread_local variable destructor is called after this one
             // and that destructor uses the temporary allocator
-            // the stack needs to grow again
+            // a new stack is acquired and never released
             // but who does temporary allocation in a destructor?!
-            temporary_stack_list.clear(*temp_stack);
+            temporary_stack_list.clear(*::std::exchange(temp_stack, nullptr));
     }
 } thread_exit_detector;
 
+temporary_stack* acquire_stack(::std::size_t size) noexcept {
+    (void)&thread_exit_detector; // ODR-use it, so it will be created for this thread
+    return temporary_stack_list.create(size);
+}
+
 } // namespace
 
-temporary_list_node::temporary_list_node(int) noexcept : in_use_{true} {
+temporary_list_node::temporary_list_node(int) noexcept {
     next_ = temporary_stack_list.first.load();
     while (!temporary_stack_list.first.compare_exchange_weak(next_, this))
         ;
-    (void)&thread_exit_detector; // ODR-use it, so it will be created
 }
 
 temporary_allocator_dtor::temporary_allocator_dtor() noexcept {
@@ -133,7 +176,7 @@ temporary_allocator_dtor::temporary_allocator_dtor() noexcept {
 }
 
 temporary_allocator_dtor::~temporary_allocator_dtor() {
-    if (--nifty_counter == 0u && temp_stack) {
+    if (--nifty_counter == 0u) {
         temporary_stack_list.destroy();
     }
 }
@@ -144,21 +187,21 @@ temporary_allocator_dtor::~temporary_allocator_dtor() {
 #if FLUX_MEMORY_TEMPORARY_STACK_MODE >= 2
 temporary_stack_initializer::temporary_stack_initializer(::std::size_t size) noexcept {
     if (!detail::temp_stack) {
-        detail::temp_stack = detail::temporary_stack_list.create(size);
+        detail::temp_stack = detail::acquire_stack(size);
     }
 }
 
 temporary_stack_initializer::~temporary_stack_initializer() {
     // don't destroy, nifty counter does that
-    // but can get rid of all the memory
+    // but can get rid of all the memory and hand the stack to the next thread
     if (detail::temp_stack) {
-        detail::temporary_stack_list.clear(*detail::temp_stack);
+        detail::temporary_stack_list.clear(*::std::exchange(detail::temp_stack, nullptr));
     }
 }
 
 temporary_stack& get_temporary_stack(::std::size_t size) noexcept {
     if (!detail::temp_stack) {
-        detail::temp_stack = detail::temporary_stack_list.create(size);
+        detail::temp_stack = detail::acquire_stack(size);
     }
     return *detail::temp_stack;
 }
@@ -218,10 +261,57 @@ temporary_stack& stack(::std::size_t) noexcept {
 
 temporary_stack_initializer::defer_create const temporary_stack_initializer::create;
 
+temporary_stack_stats temporary_stack::stats() noexcept {
+    auto& allocator = stack_.allocator();
+    return {peak_,
+            capacity(),
+            allocator.block_count(),
+            allocator.reserved_size(),
+            allocator.allocation_count(),
+            resize_count_};
+}
+
+void temporary_stack::on_reset() noexcept {
+    FLUX_ASSERT(!top_ && used_ == 0u);
+    auto const peak = ::std::exchange(scope_peak_, 0u);
+    peak_           = ::std::max(peak_, peak);
+    window_peak_    = ::std::max(window_peak_, peak);
+
+    if (peak > capacity()) {
+        // The scope spilled over into further blocks, make the first one fit it with some headroom.
+        rebuild(peak + peak / 4u);
+    } else if (decay_period_ && ++scopes_ >= decay_period_) {
+        auto const window = ::std::exchange(window_peak_, 0u);
+        scopes_           = 0u;
+        // Only shrink if the stack is way too big, so that it doesn't oscillate.
+        auto const target = ::std::max(window + window / 4u,
+                                       min_size_ - detail::memory_block_stack::offset());
+        if (window < capacity() / 4u && target < capacity())
+            rebuild(target);
+    }
+}
+
+void temporary_stack::rebuild(size_type capacity) noexcept {
+    using block_stack = detail::temporary_block_stack;
+
+    auto&      allocator  = stack_.allocator();
+    auto const tracker    = allocator.growth_tracker();
+    auto const count      = allocator.allocation_count();
+    auto const block_size = block_stack::min_block_size(capacity);
+
+    stack_.~block_stack();
+    ::new (static_cast<void*>(&stack_)) block_stack{block_size};
+    // Keep the settings and the statistics, the new stack has already allocated its first block.
+    stack_.allocator().growth_tracker(tracker);
+    stack_.allocator().allocation_count_ += count;
+    first_size_ = block_size;
+    ++resize_count_;
+}
+
 temporary_allocator::temporary_allocator() noexcept : temporary_allocator{get_temporary_stack()} {}
 
 temporary_allocator::temporary_allocator(temporary_stack& stack) noexcept
-        : unwinder_{stack}, prev_{stack.top_}, shrink_to_fit_{false} {
+        : unwinder_{stack}, prev_{stack.top_}, used_{stack.used_}, shrink_to_fit_{false} {
     FLUX_ASSERT(!prev_ || prev_->is_active());
     stack.top_ = this;
 }
@@ -230,17 +320,26 @@ temporary_allocator::~temporary_allocator() {
     if (is_active()) {
         auto& stack = unwinder_.stack();
         stack.top_  = prev_;
+        stack.used_ = used_;
         unwinder_.unwind();
 
         if (shrink_to_fit_) {
             stack.stack_.shrink_to_fit();
         }
+        if (!prev_) {
+            // The stack may be rebuilt, which invalidates the marker of the unwinder.
+            unwinder_.release();
+            stack.on_reset();
+        }
     }
 }
 
 void* temporary_allocator::allocate(size_type size, size_type alignment) noexcept {
     FLUX_ASSERT(is_active());
-    return unwinder_.stack().stack_.allocate(size, alignment);
+    auto& stack = unwinder_.stack();
+    // An upper bound of what the allocation occupies on the stack, including alignment and fences.
+    stack.on_allocate(size + alignment - 1u + 2u * detail::debug_fence_size);
+    return stack.stack_.allocate(size, alignment);
 }
 
 void temporary_allocator::shrink_to_fit() noexcept {
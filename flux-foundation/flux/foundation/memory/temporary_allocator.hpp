@@ -1,10 +1,6 @@
 #pragma once
 #include <flux/foundation/memory/memory_stack.hpp>
 
-#if FLUX_MEMORY_TEMPORARY_STACK_MODE >= 2
-#    include <atomic>
-#endif
-
 namespace flux::fou {
 
 class [[nodiscard]] temporary_allocator;
@@ -31,9 +27,29 @@ struct [[nodiscard]] temporary_block_allocator {
 
     growth_tracker_type growth_tracker() noexcept;
 
+    // Returns the number of blocks currently allocated.
+    size_type block_count() const noexcept {
+        return block_count_;
+    }
+
+    // Returns the total size of the blocks currently allocated.
+    size_type reserved_size() const noexcept {
+        return reserved_size_;
+    }
+
+    // Returns the number of blocks ever allocated.
+    size_type allocation_count() const noexcept {
+        return allocation_count_;
+    }
+
 private:
     growth_tracker_type tracker_;
     size_type           block_size_;
+    size_type           block_count_      = 0u;
+    size_type           reserved_size_    = 0u;
+    size_type           allocation_count_ = 0u;
+
+    friend temporary_stack;
 };
 
 struct [[nodiscard]] temporary_list;
@@ -42,15 +58,17 @@ using temporary_block_stack = memory_stack<temporary_block_allocator>;
 
 #if FLUX_MEMORY_TEMPORARY_STACK_MODE >= 2
 struct [[nodiscard]] temporary_list_node {
-    temporary_list_node() noexcept : in_use_{true} {}
+    temporary_list_node() noexcept = default;
 
     explicit temporary_list_node(int) noexcept;
 
     ~temporary_list_node() = default;
 
 private:
+    // Links all stacks ever created, so that they can be destroyed on program exit.
     temporary_list_node* next_ = nullptr;
-    ::std::atomic_bool   in_use_;
+    // Links the stacks released by their threads, so that they can be reused by new threads.
+    temporary_list_node* next_free_ = nullptr;
 
     friend temporary_list;
 };
@@ -71,8 +89,27 @@ protected:
 
 } // namespace detail
 
+// Statistics of a `temporary_stack`, see `temporary_stack::stats()`.
+struct [[nodiscard]] temporary_stack_stats final {
+    // The highest number of bytes used at once since the stack was created.
+    ::std::size_t peak;
+    // The usable size of the first block, which is what the stack serves without growing.
+    ::std::size_t capacity;
+    // The number and total size of the blocks currently allocated, including cached ones.
+    ::std::size_t block_count;
+    ::std::size_t reserved_size;
+    // The number of blocks ever allocated, it stays constant once the stack has settled.
+    ::std::size_t allocation_count;
+    // The number of times the first block was resized to the observed peak.
+    ::std::size_t resize_count;
+};
+
 // A wrapper around the `memory_stack` that is used by the `temporary_allocator`. There should be at
-// least one per-thread.
+// least one per-thread. The stack tunes itself to its workload: it tracks the high-water mark of
+// the outermost `temporary_allocator` scopes, and when such a scope needed more than the first
+// block, the stack is rebuilt on reset with a first block that fits the peak plus some headroom.
+// If the peak stays far below the first block for `decay_period()` scopes, the stack shrinks
+// again. In steady state it thus does not allocate any blocks at all.
 class [[nodiscard]] temporary_stack : detail::temporary_list_node {
     using block_allocator = detail::temporary_block_allocator;
     using list_node       = detail::temporary_list_node;
@@ -83,7 +120,10 @@ public:
     using difference_type     = typename block_allocator::difference_type;
     using growth_tracker_type = typename block_allocator::growth_tracker_type;
 
-    explicit temporary_stack(size_type size) noexcept : stack_{size}, top_{nullptr} {}
+    static constexpr size_type default_decay_period = 256u;
+
+    explicit temporary_stack(size_type size) noexcept
+            : stack_{size}, top_{nullptr}, min_size_{size}, first_size_{size} {}
 
     growth_tracker_type growth_tracker(growth_tracker_type tracker) noexcept {
         return stack_.allocator().growth_tracker(tracker);
@@ -97,8 +137,28 @@ public:
         return stack_.next_capacity();
     }
 
+    // Returns the blocks that are not used by any `temporary_allocator` to the heap.
+    // NOTE:
+    //  Must only be called by the thread owning the stack.
+    void shrink_to_fit() noexcept {
+        stack_.shrink_to_fit();
+    }
+
+    // Returns the number of outermost scopes after which a stack that is much bigger than needed
+    // shrinks to the peak of those scopes. Zero disables the decay.
+    size_type decay_period() const noexcept {
+        return decay_period_;
+    }
+
+    void decay_period(size_type scopes) noexcept {
+        decay_period_ = scopes;
+    }
+
+    temporary_stack_stats stats() noexcept;
+
 private:
-    temporary_stack(int i, size_type size) noexcept : list_node{i}, stack_{size}, top_{nullptr} {}
+    temporary_stack(int i, size_type size) noexcept
+            : list_node{i}, stack_{size}, top_{nullptr}, min_size_{size}, first_size_{size} {}
 
     marker top() const noexcept {
         return stack_.top();
@@ -108,8 +168,33 @@ private:
         stack_.unwind(m);
     }
 
+    void on_allocate(size_type size) noexcept {
+        used_ += size;
+        if (used_ > scope_peak_)
+            scope_peak_ = used_;
+    }
+
+    // Called after the outermost `temporary_allocator` has unwound the stack.
+    void on_reset() noexcept;
+
+    // Replaces the stack by one whose first block has the given usable size.
+    void rebuild(size_type capacity) noexcept;
+
+    size_type capacity() const noexcept {
+        return first_size_ - detail::memory_block_stack::offset();
+    }
+
     detail::temporary_block_stack stack_;
     temporary_allocator*          top_;
+    size_type                     min_size_;
+    size_type                     first_size_;
+    size_type                     used_         = 0u;
+    size_type                     scope_peak_   = 0u;
+    size_type                     window_peak_  = 0u;
+    size_type                     peak_         = 0u;
+    size_type                     scopes_       = 0u;
+    size_type                     decay_period_ = default_decay_period;
+    size_type                     resize_count_ = 0u;
 
     friend temporary_allocator;
     friend memory_stack_unwinder<temporary_stack>;
@@ -125,7 +210,8 @@ private:
 // - If `FLUX_TEMPORARY_STACK_MODE == 2`, it is not necessary to use this class, the nifty counter
 //   will clean everything upon program termination. But it can still be used as an optimization if
 //   you have a thread that is terminated long before program exit. The automatic clean up will only
-//   occur much later.
+//   occur much later. Released stacks are reused by threads created later on, without giving up
+//   the block size they have grown to.
 // - If `FLUX_TEMPORARY_STACK_MODE == 0`, the use of this class has no effect, because the
 //   per-thread stack is disabled.
 struct [[nodiscard]] temporary_stack_initializer {
@@ -186,6 +272,7 @@ public:
 private:
     stack_unwinder  unwinder_;
     allocator_type* prev_;
+    size_type       used_;
     bool            shrink_to_fit_;
 };
 
@@ -240,6 +327,36 @@ struct [[nodiscard]] allocator_traits<temporary_allocator> final {
         (void)alignment;
     }
 
+    static constexpr memory_block
+    allocate_at_least(allocator_type& allocator,
+                      size_type       size     ,
+                      size_type       alignment) noexcept
+    {
+        return {allocate_node(allocator, size, alignment), size};
+    }
+
+    static constexpr bool
+    try_expand(allocator_type& allocator,
+               void*           node     ,
+               size_type       size     ,
+               size_type       new_size ,
+               size_type       alignment) noexcept
+    {
+        (void)allocator, (void)node, (void)size, (void)new_size, (void)alignment;
+        return false;
+    }
+
+    static constexpr void*
+    try_reallocate(allocator_type& allocator,
+                   void*           node     ,
+                   size_type       size     ,
+                   size_type       new_size ,
+                   size_type       alignment) noexcept
+    {
+        (void)allocator, (void)node, (void)size, (void)new_size, (void)alignment;
+        return nullptr;
+    }
+
     static constexpr size_type max_node_size(allocator_type const& allocator) noexcept {
         return allocator.stack().next_capacity();
     }
@@ -198,6 +198,54 @@ struct [[nodiscard]] uninitialized_memcpy_or_memmove_fn final {
 inline constexpr auto uninitialized_memcpy__  = uninitialized_memcpy_or_memmove_fn<false>{};
 inline constexpr auto uninitialized_memmove__ = uninitialized_memcpy_or_memmove_fn<true>{};
 
+// clang-format off
+struct [[nodiscard]] uninitialized_memrelocate_fn final {
+    template <typename InputIterator, typename OutputIterator>
+    using result = in_out_result<InputIterator, OutputIterator>;
+
+    template <meta::input_iterator              InputIterator,
+              meta::sentinel_for<InputIterator> InputSentinel,
+              meta::nothrow_forward_iterator    OutputIterator>
+        requires meta::memrelocatable<InputIterator, OutputIterator>
+    FLUX_ALWAYS_INLINE
+    static constexpr OutputIterator operator()(InputIterator  first,
+                                               InputSentinel  last,
+                                               OutputIterator result) noexcept {
+        auto const count = last - first;
+        detail::constexpr_relocate(detail::to_address(result), detail::to_address(first),
+                                   static_cast<::std::size_t>(count));
+        return result + count;
+    }
+
+    template <meta::input_iterator                       InputIterator,
+              meta::sentinel_for<InputIterator>          InputSentinel,
+              meta::nothrow_forward_iterator             OutputIterator,
+              meta::nothrow_sentinel_for<OutputIterator> OutputSentinel>
+        requires meta::memrelocatable<InputIterator, OutputIterator>
+    FLUX_ALWAYS_INLINE
+    static constexpr auto operator()(InputIterator  ifirst, InputSentinel  ilast,
+                                     OutputIterator ofirst, OutputSentinel olast) noexcept
+            -> result<InputIterator, OutputIterator> {
+        constexpr bool sized_input  = meta::sized_sentinel_for< InputSentinel,  InputIterator>;
+        constexpr bool sized_output = meta::sized_sentinel_for<OutputSentinel, OutputIterator>;
+        meta::iter_diff_t<InputIterator> count;
+        if constexpr (sized_input && sized_output) {
+            count = ::std::min(ilast - ifirst, olast - ofirst);
+        } else if constexpr (sized_input) {
+            count = ilast - ifirst;
+        } else if constexpr (sized_output) {
+            count = olast - ofirst;
+        } else {
+            static_assert(false, "two ranges with unreachable sentinels");
+        }
+        detail::constexpr_relocate(detail::to_address(ofirst), detail::to_address(ifirst),
+                                   static_cast<::std::size_t>(count));
+        return {ifirst + count, ofirst + count};
+    }
+};
+// clang-format on
+inline constexpr auto uninitialized_memrelocate__ = uninitialized_memrelocate_fn{};
+
 template <bool IsMove>
 struct [[nodiscard]] uninitialized_copy_or_move_fn final {
     template <typename InputIterator, typename OutputIterator>
@@ -471,6 +519,9 @@ struct [[nodiscard]] uninitialized_relocate_fn final {
         if constexpr (meta::memcpyable<InputIterator, OutputIterator>) {
             return uninitialized_memmove__(::std::move(first), ::std::move(last),
                                            ::std::move(result));
+        } else if constexpr (meta::memrelocatable<InputIterator, OutputIterator>) {
+            return uninitialized_memrelocate__(::std::move(first), ::std::move(last),
+                                               ::std::move(result));
         } else {
             auto current = result;
             for (; first != last; ++current, (void)++first) {
@@ -492,6 +543,9 @@ struct [[nodiscard]] uninitialized_relocate_fn final {
         if constexpr (meta::memcpyable<InputIterator, OutputIterator>) {
             return uninitialized_memmove__(::std::move(ifirst), ::std::move(ilast),
                                            ::std::move(ofirst), ::std::move(olast));
+        } else if constexpr (meta::memrelocatable<InputIterator, OutputIterator>) {
+            return uninitialized_memrelocate__(::std::move(ifirst), ::std::move(ilast),
+                                               ::std::move(ofirst), ::std::move(olast));
         } else {
             for (; ifirst != ilast && ofirst != olast; ++ofirst, (void)++ifirst) {
                 relocate_at(detail::to_address(ifirst), detail::to_address(ofirst));
@@ -527,6 +581,9 @@ struct [[nodiscard]] uninitialized_relocate_no_overlap_fn final {
         if constexpr (meta::memcpyable<InputIterator, OutputIterator>) {
             return uninitialized_memcpy__(::std::move(first), ::std::move(last),
                                           ::std::move(result));
+        } else if constexpr (meta::memrelocatable<InputIterator, OutputIterator>) {
+            return uninitialized_memrelocate__(::std::move(first), ::std::move(last),
+                                               ::std::move(result));
         } else {
             auto current = result;
             for (; first != last; ++current, (void)++first) {
@@ -548,6 +605,9 @@ struct [[nodiscard]] uninitialized_relocate_no_overlap_fn final {
         if constexpr (meta::memcpyable<InputIterator, OutputIterator>) {
             return uninitialized_memcpy__(::std::move(ifirst), ::std::move(ilast),
                                           ::std::move(ofirst), ::std::move(olast));
+        } else if constexpr (meta::memrelocatable<InputIterator, OutputIterator>) {
+            return uninitialized_memrelocate__(::std::move(ifirst), ::std::move(ilast),
+                                               ::std::move(ofirst), ::std::move(olast));
         } else {
             for (; ifirst != ilast && ofirst != olast; ++ofirst, (void)++ifirst) {
                 relocate_at(detail::to_address(ifirst), detail::to_address(ofirst));
@@ -44,10 +44,10 @@ union [[nodiscard, clang::trivial_abi]] uninitialized_storage final {
     constexpr ~uninitialized_storage() {}
 
     [[nodiscard]] constexpr value_type* data() noexcept {
-        return addressof(value);
+        return fou::addressof(value);
     }
     [[nodiscard]] constexpr value_type const* data() const noexcept {
-        return addressof(value);
+        return fou::addressof(value);
     }
 };
 // clang-format on
@@ -2,9 +2,11 @@
 
 #include <flux/foundation/utility/addressof.hpp>
 #include <flux/foundation/utility/advance.hpp>
+#include <flux/foundation/utility/compact_optional.hpp>
 #include <flux/foundation/utility/in_out_result.hpp>
 #include <flux/foundation/utility/is_pointer_in_range.hpp>
 #include <flux/foundation/utility/launder.hpp>
 #include <flux/foundation/utility/next.hpp>
+#include <flux/foundation/utility/packed_variant.hpp>
 #include <flux/foundation/utility/terminate.hpp>
 #include <flux/foundation/utility/unreachable.hpp>
\ No newline at end of file
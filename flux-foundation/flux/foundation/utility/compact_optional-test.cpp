@@ -0,0 +1,104 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <optional>
+#include <string>
+
+using namespace flux;
+using namespace flux::fou;
+
+namespace {
+
+// Not a POD for the purpose of layout, so its tail padding may be reused.
+struct padded {
+    padded() noexcept = default;
+    padded(float px, float py, float pz, u8 bits) noexcept : x{px}, y{py}, z{pz}, flags{bits} {}
+
+    bool operator==(padded const&) const noexcept = default;
+
+    float x     = 0.0f;
+    float y     = 0.0f;
+    float z     = 0.0f;
+    u8    flags = 0u;
+};
+
+} // namespace
+
+TEST_CASE("fou::compact_optional", "[flux-utility/compact_optional.hpp]") {
+    SECTION("niche") {
+        using optional = compact_optional<slot_handle>;
+        static_assert(optional::layout == detail::compact_optional_layout::niche);
+        static_assert(sizeof(optional) == sizeof(slot_handle));
+        static_assert(meta::trivially_copyable<optional>);
+
+        optional handle;
+        CHECK(!handle);
+        CHECK(handle == ::std::nullopt);
+
+        handle = slot_handle{};
+        CHECK(handle);
+        CHECK(*handle == slot_handle{});
+
+        handle = slot_handle{1u, UINT32_MAX};
+        CHECK(handle->index() == 1u);
+        CHECK(handle->generation() == UINT32_MAX);
+
+        // A handle with the null index never looks like a niche.
+        handle = slot_handle{slot_handle::npos, 5u};
+        CHECK(handle);
+        CHECK(*handle == slot_handle{});
+        CHECK(compact_optional<slot_handle>{slot_handle::from_value(0x0000'0005'ffff'ffffu)});
+
+        handle.reset();
+        CHECK(!handle);
+        CHECK(handle.value_or(slot_handle{2u, 3u}) == slot_handle{2u, 3u});
+
+        static_assert(sizeof(compact_optional<bool>) == sizeof(bool));
+        compact_optional<bool> flag{false};
+        CHECK(flag);
+        CHECK(!*flag);
+    }
+    SECTION("tail padding") {
+        using optional = compact_optional<padded>;
+        static_assert(optional::layout == detail::compact_optional_layout::tail_padding);
+        static_assert(sizeof(optional) == sizeof(padded));
+        static_assert(meta::trivially_copyable<optional>);
+
+        optional value;
+        CHECK(!value);
+
+        value.emplace(1.0f, 2.0f, 3.0f, u8{4u});
+        CHECK(value);
+        CHECK(value->flags == 4u);
+
+        *value = padded{};
+        CHECK(value);
+        CHECK(*value == padded{});
+
+        auto const copy = value;
+        CHECK(copy == value);
+        value = ::std::nullopt;
+        CHECK(!value);
+        CHECK(copy != value);
+    }
+    SECTION("flag") {
+        using optional = compact_optional<::std::string>;
+        static_assert(optional::layout == detail::compact_optional_layout::flag);
+        static_assert(sizeof(compact_optional<u64>) == sizeof(::std::optional<u64>));
+
+        optional string{::std::string(32u, 'a')};
+        CHECK(string);
+
+        auto moved = ::std::move(string);
+        CHECK(moved == ::std::string(32u, 'a'));
+
+        optional copy;
+        copy = moved;
+        CHECK(copy == moved);
+        copy.emplace("b");
+        CHECK(*copy == "b");
+        copy = optional{};
+        CHECK(!copy);
+    }
+}
@@ -0,0 +1,272 @@
+#pragma once
+#include <flux/foundation/utility/launder.hpp>
+#include <flux/meta/datasizeof.hpp>
+
+#include <memory>
+#include <optional>
+
+namespace flux::fou {
+
+namespace detail {
+
+// Where a `compact_optional` stores whether it holds a value.
+enum class [[nodiscard]] compact_optional_layout : unsigned char {
+    niche,        // in a niche of `T`, see `meta::niche_traits`
+    tail_padding, // in the first byte of the tail padding of `T`
+    flag,         // in a `bool` after `T`
+};
+
+template <typename T>
+inline constexpr auto compact_optional_layout_of =
+        meta::has_niche<T>                  ? compact_optional_layout::niche
+        : meta::data_size_of<T> < sizeof(T) ? compact_optional_layout::tail_padding
+                                            : compact_optional_layout::flag;
+
+template <typename T, compact_optional_layout = compact_optional_layout_of<T>>
+struct [[nodiscard]] compact_optional_storage {
+    using niche_traits = meta::niche_traits<T>;
+
+    alignas(T) ::std::byte bytes[sizeof(T)];
+
+    compact_optional_storage() noexcept {
+        niche_traits::store(bytes, 0u);
+    }
+
+    bool engaged() const noexcept {
+        return niche_traits::load(bytes) == niche_traits::count;
+    }
+
+    // Constructing the value overwrites the niche.
+    void set_engaged() noexcept {}
+
+    void set_disengaged() noexcept {
+        niche_traits::store(bytes, 0u);
+    }
+};
+
+// NOTE:
+//  A class with tail padding is not a POD for the purpose of layout, so the compiler must not write
+//  to its tail padding through a `T&`, which may refer to a base class subobject whose tail padding
+//  holds members of the derived class. Constructing a `T` may write to it anyway, so the flag is
+//  only written after the value is constructed.
+template <typename T>
+struct [[nodiscard]] compact_optional_storage<T, compact_optional_layout::tail_padding> {
+    static constexpr ::std::size_t flag_offset = meta::data_size_of<T>;
+
+    alignas(T) ::std::byte bytes[sizeof(T)];
+
+    compact_optional_storage() noexcept {
+        set_disengaged();
+    }
+
+    bool engaged() const noexcept {
+        return bytes[flag_offset] != ::std::byte{0u};
+    }
+
+    void set_engaged() noexcept {
+        bytes[flag_offset] = ::std::byte{1u};
+    }
+
+    void set_disengaged() noexcept {
+        bytes[flag_offset] = ::std::byte{0u};
+    }
+};
+
+template <typename T>
+struct [[nodiscard]] compact_optional_storage<T, compact_optional_layout::flag> {
+    alignas(T) ::std::byte bytes[sizeof(T)];
+    bool                   flag = false;
+
+    bool engaged() const noexcept {
+        return flag;
+    }
+
+    void set_engaged() noexcept {
+        flag = true;
+    }
+
+    void set_disengaged() noexcept {
+        flag = false;
+    }
+};
+
+} // namespace detail
+
+// An optional `T` that is as big as a `T` whenever `T` has a niche or tail padding to store
+// whether it holds a value, see `detail::compact_optional_layout`. Otherwise it is laid out like
+// `std::optional<T>`. It is trivially copyable if `T` is, so arrays of them can be copied with
+// `memcpy`.
+// NOTE:
+//  The value lives in an array of bytes, so unlike `std::optional` it cannot be used in constant
+//  expressions.
+template <meta::nothrow_move_constructible T>
+    requires(meta::object<T> and meta::nothrow_destructible<T>)
+class [[nodiscard]] compact_optional {
+    using storage_type = detail::compact_optional_storage<T>;
+
+public:
+    using value_type            = T;
+    using trivially_relocatable = ::std::bool_constant<meta::trivially_relocatable<T>>;
+
+    static constexpr auto layout = detail::compact_optional_layout_of<T>;
+
+    compact_optional() noexcept = default;
+
+    explicit(false) compact_optional(::std::nullopt_t) noexcept {}
+
+    // clang-format off
+    template <typename U = T>
+        requires(meta::constructible<T, U&&> and
+                 not meta::same_as<meta::remove_cvref_t<U>, compact_optional> and
+                 not meta::same_as<meta::remove_cvref_t<U>, ::std::nullopt_t>)
+    explicit(not meta::convertible_to<U&&, T>) compact_optional(U&& value) noexcept {
+        emplace(::std::forward<U>(value));
+    }
+
+    compact_optional(compact_optional const& other) noexcept
+        requires(meta::copy_constructible<T> and meta::trivially_copy_constructible<T>)
+    = default;
+    compact_optional(compact_optional const& other) noexcept
+        requires meta::copy_constructible<T>
+    {
+        if (other.has_value())
+            emplace(*other);
+    }
+
+    compact_optional(compact_optional&& other) noexcept
+        requires meta::trivially_move_constructible<T>
+    = default;
+    compact_optional(compact_optional&& other) noexcept {
+        if (other.has_value())
+            emplace(::std::move(*other));
+    }
+
+    compact_optional& operator=(compact_optional const& other) noexcept
+        requires(meta::copy_constructible<T> and meta::copy_assignable<T> and
+                 meta::trivially_copy_constructible<T> and meta::trivially_copy_assignable<T> and
+                 meta::trivially_destructible<T>)
+    = default;
+    compact_optional& operator=(compact_optional const& other) noexcept
+        requires(meta::copy_constructible<T> and meta::copy_assignable<T>)
+    {
+        assign(other);
+        return *this;
+    }
+
+    compact_optional& operator=(compact_optional&& other) noexcept
+        requires(meta::move_assignable<T> and meta::trivially_move_constructible<T> and
+                 meta::trivially_move_assignable<T> and meta::trivially_destructible<T>)
+    = default;
+    compact_optional& operator=(compact_optional&& other) noexcept
+        requires meta::move_assignable<T>
+    {
+        assign(::std::move(other));
+        return *this;
+    }
+
+    ~compact_optional() requires meta::trivially_destructible<T> = default;
+    ~compact_optional() {
+        if (has_value())
+            ::std::destroy_at(data());
+    }
+    // clang-format on
+
+    compact_optional& operator=(::std::nullopt_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    template <typename... Args>
+    T& emplace(Args&&... args) noexcept {
+        reset();
+        ::std::construct_at(data(), ::std::forward<Args>(args)...);
+        storage_.set_engaged();
+        return *data();
+    }
+
+    void reset() noexcept {
+        if (has_value()) {
+            ::std::destroy_at(data());
+            storage_.set_disengaged();
+        }
+    }
+
+    bool has_value() const noexcept {
+        return storage_.engaged();
+    }
+
+    explicit operator bool() const noexcept {
+        return has_value();
+    }
+
+    T& operator*() noexcept {
+        FLUX_ASSERT(has_value());
+        return *data();
+    }
+    T const& operator*() const noexcept {
+        FLUX_ASSERT(has_value());
+        return *data();
+    }
+
+    T* operator->() noexcept {
+        FLUX_ASSERT(has_value());
+        return data();
+    }
+    T const* operator->() const noexcept {
+        FLUX_ASSERT(has_value());
+        return data();
+    }
+
+    template <typename U>
+    T value_or(U&& fallback) const noexcept {
+        return has_value() ? *data() : static_cast<T>(::std::forward<U>(fallback));
+    }
+
+    friend bool operator==(compact_optional const& lhs, compact_optional const& rhs) noexcept {
+        if (lhs.has_value() != rhs.has_value())
+            return false;
+        return not lhs.has_value() or *lhs == *rhs;
+    }
+
+    friend bool operator==(compact_optional const& lhs, T const& rhs) noexcept {
+        return lhs.has_value() and *lhs == rhs;
+    }
+
+    friend bool operator==(compact_optional const& lhs, ::std::nullopt_t) noexcept {
+        return not lhs.has_value();
+    }
+
+private:
+    T* data() noexcept {
+        return fou::launder(reinterpret_cast<T*>(storage_.bytes));
+    }
+    T const* data() const noexcept {
+        return fou::launder(reinterpret_cast<T const*>(storage_.bytes));
+    }
+
+    void assign(compact_optional const& other) noexcept {
+        if (not other.has_value()) {
+            reset();
+        } else if (has_value()) {
+            *data() = *other;
+            storage_.set_engaged();
+        } else {
+            emplace(*other);
+        }
+    }
+
+    void assign(compact_optional&& other) noexcept {
+        if (not other.has_value()) {
+            reset();
+        } else if (has_value()) {
+            *data() = ::std::move(*other);
+            storage_.set_engaged();
+        } else {
+            emplace(::std::move(*other));
+        }
+    }
+
+    storage_type storage_;
+};
+
+} // namespace flux::fou
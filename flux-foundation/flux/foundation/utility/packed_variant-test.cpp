@@ -0,0 +1,71 @@
+#include <flux/foundation.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <variant>
+
+using namespace flux;
+using namespace flux::fou;
+
+namespace {
+
+// Not a POD for the purpose of layout, so its tail padding may be reused.
+struct padded {
+    padded() noexcept = default;
+    padded(u32 first, u8 second) noexcept : a{first}, b{second} {}
+
+    bool operator==(padded const&) const noexcept = default;
+
+    u32 a = 0u;
+    u8  b = 0u;
+};
+
+} // namespace
+
+TEST_CASE("fou::packed_variant", "[flux-utility/packed_variant.hpp]") {
+    SECTION("tail padding") {
+        using variant = packed_variant<padded, u32, float>;
+        static_assert(variant::index_in_padding);
+        static_assert(sizeof(variant) == sizeof(padded));
+        static_assert(meta::trivially_copyable<variant>);
+        static_assert(variant::index_of<float> == 2u);
+
+        variant value;
+        CHECK(value.index() == 0u);
+        CHECK(value.get<padded>() == padded{});
+
+        value = 7u;
+        CHECK(value.holds<u32>());
+        CHECK(value.get<u32>() == 7u);
+        CHECK(value.get_if<padded>() == nullptr);
+
+        value.emplace<padded>(1u, u8{2u});
+        value.get<padded>().b = 3u;
+        CHECK(value.holds<padded>());
+        CHECK(value.get<padded>() == padded{1u, 3u});
+
+        auto const copy = value;
+        CHECK(copy == value);
+        value = 1.0f;
+        CHECK(copy != value);
+        CHECK(value.visit([](auto const& alternative) { return sizeof(alternative); }) == 4u);
+    }
+    SECTION("appended index") {
+        using variant = packed_variant<u64, ::std::string>;
+        static_assert(!variant::index_in_padding);
+        static_assert(sizeof(variant) == sizeof(::std::variant<u64, ::std::string>));
+
+        variant value{::std::in_place_type<::std::string>, 32u, 'a'};
+        CHECK(value.holds<::std::string>());
+
+        auto moved = ::std::move(value);
+        CHECK(moved.get<::std::string>() == ::std::string(32u, 'a'));
+
+        variant copy;
+        copy = moved;
+        CHECK(copy == moved);
+        copy = u64{5u};
+        CHECK(copy.get<u64>() == 5u);
+    }
+}
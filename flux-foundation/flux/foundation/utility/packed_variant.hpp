@@ -0,0 +1,210 @@
+#pragma once
+#include <flux/foundation/utility/addressof.hpp>
+#include <flux/foundation/utility/launder.hpp>
+#include <flux/meta/datasizeof.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+namespace flux::fou {
+
+// A variant of `Ts...` that stores the index of its alternative in a single byte, placed in the
+// tail padding shared by all alternatives when there is some. The index follows the data of the
+// biggest alternative, see `meta::data_size_of`, so a variant of a class with tail padding and of
+// smaller types is as big as that class. Otherwise it is laid out like a `std::variant`.
+// NOTE:
+//  Unlike `std::variant`, it never becomes valueless, all alternatives must be distinct and
+//  nothrow move constructible. The alternatives live in an array of bytes, so it cannot be used
+//  in constant expressions.
+template <typename... Ts>
+    requires(sizeof...(Ts) > 0u and sizeof...(Ts) <= UINT8_MAX and meta::distinct<Ts...> and
+             (meta::object<Ts> and ...) and (meta::nothrow_move_constructible<Ts> and ...) and
+             (meta::nothrow_destructible<Ts> and ...))
+class [[nodiscard]] packed_variant {
+    using index_type = unsigned char;
+
+    template <::std::size_t I>
+    using alternative = ::std::tuple_element_t<I, ::std::tuple<Ts...>>;
+
+    static constexpr ::std::size_t count        = sizeof...(Ts);
+    static constexpr ::std::size_t index_offset = ::std::max({meta::data_size_of<Ts>...});
+    static constexpr ::std::size_t bytes_size   = ::std::max({sizeof(Ts)..., index_offset + 1u});
+
+    static constexpr bool copyable          = (meta::copy_constructible<Ts> and ...);
+    static constexpr bool trivially_copied  = (meta::trivially_copyable<Ts> and ...);
+    static constexpr bool trivially_dropped = (meta::trivially_destructible<Ts> and ...);
+
+public:
+    using trivially_relocatable = ::std::bool_constant<(meta::trivially_relocatable<Ts> and ...)>;
+
+    // Whether the index lives in the tail padding of the alternatives.
+    static constexpr bool index_in_padding = index_offset < ::std::max({sizeof(Ts)...});
+
+    // The index of the alternative `T`.
+    template <typename T>
+        requires meta::contains<T, Ts...>
+    static constexpr ::std::size_t index_of = [] {
+        ::std::size_t index = 0u;
+        ((meta::same_as<T, Ts> ? false : (++index, true)) and ...);
+        return index;
+    }();
+
+    // Holds a value-initialized first alternative.
+    packed_variant() noexcept
+        requires meta::default_constructible<alternative<0u>>
+    {
+        construct<alternative<0u>>();
+    }
+
+    // clang-format off
+    template <typename U>
+        requires meta::contains<meta::remove_cvref_t<U>, Ts...>
+    explicit(false) packed_variant(U&& value) noexcept {
+        construct<meta::remove_cvref_t<U>>(::std::forward<U>(value));
+    }
+
+    template <typename T, typename... Args>
+        requires meta::contains<T, Ts...>
+    explicit packed_variant(::std::in_place_type_t<T>, Args&&... args) noexcept {
+        construct<T>(::std::forward<Args>(args)...);
+    }
+
+    packed_variant(packed_variant const&) noexcept requires(copyable and trivially_copied)
+    = default;
+    packed_variant(packed_variant const& other) noexcept
+        requires(copyable and not trivially_copied)
+    {
+        other.visit([this]<typename T>(T const& value) { construct<T>(value); });
+    }
+
+    packed_variant(packed_variant&&) noexcept requires trivially_copied = default;
+    packed_variant(packed_variant&& other) noexcept requires(not trivially_copied) {
+        other.visit([this]<typename T>(T& value) { construct<T>(::std::move(value)); });
+    }
+
+    packed_variant& operator=(packed_variant const&) noexcept
+        requires(copyable and trivially_copied)
+    = default;
+    packed_variant& operator=(packed_variant const& other) noexcept
+        requires(copyable and not trivially_copied)
+    {
+        if (this != &other) {
+            destroy();
+            other.visit([this]<typename T>(T const& value) { construct<T>(value); });
+        }
+        return *this;
+    }
+
+    packed_variant& operator=(packed_variant&&) noexcept requires trivially_copied = default;
+    packed_variant& operator=(packed_variant&& other) noexcept requires(not trivially_copied) {
+        if (this != &other) {
+            destroy();
+            other.visit([this]<typename T>(T& value) { construct<T>(::std::move(value)); });
+        }
+        return *this;
+    }
+
+    ~packed_variant() requires trivially_dropped = default;
+    ~packed_variant() {
+        destroy();
+    }
+    // clang-format on
+
+    ::std::size_t index() const noexcept {
+        return static_cast<index_type>(bytes_[index_offset]);
+    }
+
+    template <typename T>
+    bool holds() const noexcept {
+        return index() == index_of<T>;
+    }
+
+    // The variant must hold a `T`.
+    template <typename T>
+    T& get() noexcept {
+        FLUX_ASSERT(holds<T>());
+        return *data<T>();
+    }
+    template <typename T>
+    T const& get() const noexcept {
+        FLUX_ASSERT(holds<T>());
+        return *data<T>();
+    }
+
+    // Returns the `T` held by the variant, or `nullptr` if it holds another alternative.
+    template <typename T>
+    T* get_if() noexcept {
+        return holds<T>() ? data<T>() : nullptr;
+    }
+    template <typename T>
+    T const* get_if() const noexcept {
+        return holds<T>() ? data<T>() : nullptr;
+    }
+
+    template <typename T, typename... Args>
+        requires meta::contains<T, Ts...>
+    T& emplace(Args&&... args) noexcept {
+        destroy();
+        construct<T>(::std::forward<Args>(args)...);
+        return *data<T>();
+    }
+
+    // Calls `visitor` with the alternative held by the variant, all calls must return the same
+    // type.
+    template <typename Visitor>
+    decltype(auto) visit(Visitor&& visitor) {
+        return visit_from<0u>(*this, visitor);
+    }
+    template <typename Visitor>
+    decltype(auto) visit(Visitor&& visitor) const {
+        return visit_from<0u>(*this, visitor);
+    }
+
+    friend bool operator==(packed_variant const& lhs, packed_variant const& rhs) noexcept {
+        if (lhs.index() != rhs.index())
+            return false;
+        return lhs.visit([&rhs]<typename T>(T const& value) { return value == *rhs.data<T>(); });
+    }
+
+private:
+    template <typename T>
+    T* data() noexcept {
+        return fou::launder(reinterpret_cast<T*>(bytes_));
+    }
+    template <typename T>
+    T const* data() const noexcept {
+        return fou::launder(reinterpret_cast<T const*>(bytes_));
+    }
+
+    // Constructing a `T` may write to its tail padding, so the index is written afterwards, see
+    // `detail::compact_optional_storage`.
+    template <typename T, typename... Args>
+    void construct(Args&&... args) noexcept {
+        ::std::construct_at(reinterpret_cast<T*>(bytes_), ::std::forward<Args>(args)...);
+        bytes_[index_offset] = static_cast<::std::byte>(index_of<T>);
+    }
+
+    void destroy() noexcept {
+        if constexpr (not trivially_dropped) {
+            visit([]<typename T>(T& value) { ::std::destroy_at(fou::addressof(value)); });
+        }
+    }
+
+    template <::std::size_t I, typename Self, typename Visitor>
+    static decltype(auto) visit_from(Self& self, Visitor& visitor) {
+        using type = alternative<I>;
+        if constexpr (I + 1u == count) {
+            return visitor(*self.template data<type>());
+        } else {
+            if (self.index() == I)
+                return visitor(*self.template data<type>());
+            return visit_from<I + 1u>(self, visitor);
+        }
+    }
+
+    alignas(Ts...) ::std::byte bytes_[bytes_size];
+};
+
+} // namespace flux::fou
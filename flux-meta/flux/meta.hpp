@@ -1,9 +1,11 @@
 #pragma once
+#include <array>
 #include <concepts>
 #include <iterator>
 #include <ranges>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 
 // clang-format off
 #include <flux/meta/declval.hpp>
@@ -14,5 +16,6 @@
 #include <flux/meta/compare.hpp>
 #include <flux/meta/integer.hpp>
 #include <flux/meta/memcpyable.hpp>
+#include <flux/meta/niche_traits.hpp>
 #include <flux/meta/prvalue.hpp>
 #include <flux/meta/relocatable.hpp>
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+namespace flux::meta {
+
+// Describes the niches of `T`: bit patterns that no valid object of `T` has, so that a wrapper
+// like `fou::compact_optional` can store its own state in the bytes of a `T` instead of next to
+// it. Types without niches keep the primary template. A specialization provides:
+//  - `count`, the number of niches;
+//  - `store(storage, niche)`, which writes the niche `niche` into the bytes of a `T` at `storage`
+//    where no `T` lives;
+//  - `load(storage)`, which returns the niche stored at `storage`, or `count` if a `T` lives
+//    there.
+// NOTE:
+//  The niches must not be reachable through the interface of `T`, not even by a moved-from or a
+//  default constructed object, otherwise a value would be mistaken for a wrapper state.
+template <typename T>
+struct [[nodiscard]] niche_traits {
+    static constexpr ::std::size_t count = 0u;
+};
+
+// Only 0 and 1 are valid values of `bool`.
+template <>
+struct [[nodiscard]] niche_traits<bool> {
+    static constexpr ::std::size_t count = 254u;
+
+    static void store(void* storage, ::std::size_t niche) noexcept {
+        *static_cast<unsigned char*>(storage) = static_cast<unsigned char>(niche + 2u);
+    }
+
+    static ::std::size_t load(void const* storage) noexcept {
+        auto const byte = *static_cast<unsigned char const*>(storage);
+        return byte < 2u ? count : ::std::size_t{byte} - 2u;
+    }
+};
+
+template <typename T>
+concept has_niche = niche_traits<T>::count > 0u;
+
+} // namespace flux::meta
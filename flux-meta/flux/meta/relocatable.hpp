@@ -2,12 +2,65 @@
 
 namespace flux::meta {
 
+namespace detail {
+
+// clang-format off
+template <typename T>
+concept declares_trivially_relocatable = requires {
+    requires T::trivially_relocatable::value;
+};
+// clang-format on
+
+template <typename T>
+consteval bool is_trivially_relocatable_impl() noexcept {
+    if constexpr (trivially_copyable<T>) {
+        return true;
+    } else if constexpr (declares_trivially_relocatable<T>) {
+        return true;
+    } else {
+#if __has_builtin(__builtin_is_cpp_trivially_relocatable)
+        return __builtin_is_cpp_trivially_relocatable(T);
+#elif __has_builtin(__is_trivially_relocatable)
+        return __is_trivially_relocatable(T);
+#else
+        return false;
+#endif
+    }
+}
+
+} // namespace detail
+
+// Whether objects of type `T` can be relocated by copying their bytes to the new address and
+// forgetting about the old ones, without calling the move constructor and the destructor. Besides
+// trivially copyable types, this is true for class types that declare a member type
+// `trivially_relocatable` whose value is `true`, e.g. `using trivially_relocatable = true_type;`,
+// and for those the compiler considers trivially relocatable. It may also be specialized for types
+// that cannot be changed.
+// NOTE:
+//  A class holding a pointer to itself or registered by its address elsewhere is not trivially
+//  relocatable, even if it is movable.
+template <typename T>
+inline constexpr bool enable_trivially_relocatable = detail::is_trivially_relocatable_impl<T>();
+
+template <typename First, typename Second>
+inline constexpr bool enable_trivially_relocatable<::std::pair<First, Second>> =
+        enable_trivially_relocatable<First> and enable_trivially_relocatable<Second>;
+
+template <typename... Types>
+inline constexpr bool enable_trivially_relocatable<::std::tuple<Types...>> =
+        (enable_trivially_relocatable<Types> and ...);
+
+template <typename T, ::std::size_t N>
+inline constexpr bool enable_trivially_relocatable<::std::array<T, N>> =
+        enable_trivially_relocatable<T>;
+
 // clang-format off
 template <typename T>
 concept relocatable = move_constructible<T> and destructible<T>;
 
 template <typename T>
-concept trivially_relocatable = trivially_copyable<T>;
+concept trivially_relocatable = is_object_v<T>
+                            and enable_trivially_relocatable<remove_cv_t<remove_all_extents_t<T>>>;
 // clang-format on
 
 template <typename T, typename U>
@@ -17,4 +70,15 @@ concept same_trivially_relocatable =
 template <typename Src, typename Dest>
 concept relocatable_from = nothrow_constructible<Dest, Src> and nothrow_destructible<Src>;
 
-} // namespace flux::meta
\ No newline at end of file
+// Whether the values of a range can be relocated to another one with a single `memmove`.
+// clang-format off
+template <typename InputIterator, typename OutputIterator>
+concept memrelocatable = contiguous           <InputIterator, OutputIterator>
+                     and addressable          <OutputIterator>
+                     and same_as              <iter_value_t<OutputIterator>,
+                                               remove_ref_t<iter_ref_t<InputIterator>>>
+                     and trivially_relocatable<iter_value_t<OutputIterator>>
+                     and not_volatile         <InputIterator, OutputIterator>;
+// clang-format on
+
+} // namespace flux::meta
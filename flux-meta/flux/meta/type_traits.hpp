@@ -50,6 +50,8 @@ template <typename T>
 inline constexpr bool is_empty_v = ::std::is_empty_v<T>;
 template <typename T>
 inline constexpr bool is_final_v = ::std::is_final_v<T>;
+template <typename T>
+inline constexpr bool is_object_v = ::std::is_object_v<T>;
 
 template <typename T>
 inline constexpr bool is_lvalue_reference_v = ::std::is_lvalue_reference_v<T>;
@@ -96,6 +96,78 @@ extern void* FLUX_STDCALL HeapReAlloc(void*, ::std::uint_least32_t, void*, ::std
 __asm__("HeapReAlloc")
 #endif
 ;
+
+#if (__has_cpp_attribute(__gnu__::__dllimport__) && !defined(__WINE__))
+[[__gnu__::__dllimport__]]
+#endif
+#if (__has_cpp_attribute(__gnu__::__stdcall__) && !defined(__WINE__))
+[[__gnu__::__stdcall__]]
+#endif
+extern int FLUX_STDCALL VirtualLock(void*, ::std::size_t) noexcept
+#if defined(FLUX_CLANG)
+__asm__("VirtualLock")
+#endif
+;
+
+#if (__has_cpp_attribute(__gnu__::__dllimport__) && !defined(__WINE__))
+[[__gnu__::__dllimport__]]
+#endif
+#if (__has_cpp_attribute(__gnu__::__stdcall__) && !defined(__WINE__))
+[[__gnu__::__stdcall__]]
+#endif
+extern int FLUX_STDCALL VirtualUnlock(void*, ::std::size_t) noexcept
+#if defined(FLUX_CLANG)
+__asm__("VirtualUnlock")
+#endif
+;
+
+#if (__has_cpp_attribute(__gnu__::__dllimport__) && !defined(__WINE__))
+[[__gnu__::__dllimport__]]
+#endif
+#if (__has_cpp_attribute(__gnu__::__stdcall__) && !defined(__WINE__))
+[[__gnu__::__stdcall__]]
+#endif
+extern void* FLUX_STDCALL GetCurrentThread() noexcept
+#if defined(FLUX_CLANG)
+__asm__("GetCurrentThread")
+#endif
+;
+
+#if (__has_cpp_attribute(__gnu__::__dllimport__) && !defined(__WINE__))
+[[__gnu__::__dllimport__]]
+#endif
+#if (__has_cpp_attribute(__gnu__::__stdcall__) && !defined(__WINE__))
+[[__gnu__::__stdcall__]]
+#endif
+extern void* FLUX_STDCALL GetCurrentProcess() noexcept
+#if defined(FLUX_CLANG)
+__asm__("GetCurrentProcess")
+#endif
+;
+
+#if (__has_cpp_attribute(__gnu__::__dllimport__) && !defined(__WINE__))
+[[__gnu__::__dllimport__]]
+#endif
+#if (__has_cpp_attribute(__gnu__::__stdcall__) && !defined(__WINE__))
+[[__gnu__::__stdcall__]]
+#endif
+extern int FLUX_STDCALL GetProcessAffinityMask(void*, ::std::uintptr_t*, ::std::uintptr_t*) noexcept
+#if defined(FLUX_CLANG)
+__asm__("GetProcessAffinityMask")
+#endif
+;
+
+#if (__has_cpp_attribute(__gnu__::__dllimport__) && !defined(__WINE__))
+[[__gnu__::__dllimport__]]
+#endif
+#if (__has_cpp_attribute(__gnu__::__stdcall__) && !defined(__WINE__))
+[[__gnu__::__stdcall__]]
+#endif
+extern ::std::uintptr_t FLUX_STDCALL SetThreadAffinityMask(void*, ::std::uintptr_t) noexcept
+#if defined(FLUX_CLANG)
+__asm__("SetThreadAffinityMask")
+#endif
+;
 // clang-format on
 
 } // namespace flux::win32
\ No newline at end of file